@@ -0,0 +1,118 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+// Compares the two ways ComputeSystemThumbnailResult hands out its image when it is read repeatedly, as when
+// Dev Home refreshes the thumbnails of many virtual machines. ThumbnailInBytes copies the image into a new array
+// on every call. Thumbnail copies it once, when the result is created, and returns the same buffer afterwards.
+// The buffers are modeled with std::vector, and a shared_ptr stands in for the reference counted IBuffer.
+//
+// Only copies inside the process are measured. Reading Thumbnail from another process also copies the buffer
+// when it is marshaled, which needs COM and an out-of-process extension.
+//
+// Usage: ComputeSystemThumbnailBenchmark [accesses per result]
+
+#include "pch.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <numeric>
+
+namespace
+{
+    constexpr int Iterations = 20;
+    constexpr size_t ThumbnailSize = 512 * 1024;
+
+    template <typename Function>
+    double MeasureMicroseconds(Function&& function)
+    {
+        auto best = std::chrono::steady_clock::duration::max();
+        for (int i = 0; i < Iterations; i++)
+        {
+            auto start = std::chrono::steady_clock::now();
+            function();
+            best = std::min(best, std::chrono::steady_clock::now() - start);
+        }
+
+        return std::chrono::duration<double, std::micro>(best).count();
+    }
+
+    // What ThumbnailInBytes does: the result keeps the image and copies it for every caller.
+    class CopyingThumbnailResult
+    {
+    public:
+        explicit CopyingThumbnailResult(std::vector<uint8_t> const& image) :
+            m_image(image)
+        {
+        }
+
+        std::vector<uint8_t> ThumbnailInBytes() const
+        {
+            return m_image;
+        }
+
+    private:
+        std::vector<uint8_t> m_image;
+    };
+
+    // What Thumbnail does: the image is copied once into a shared buffer, and callers get a reference to it.
+    class SharedThumbnailResult
+    {
+    public:
+        explicit SharedThumbnailResult(std::vector<uint8_t> const& image) :
+            m_thumbnail(std::make_shared<std::vector<uint8_t> const>(image))
+        {
+        }
+
+        std::shared_ptr<std::vector<uint8_t> const> Thumbnail() const
+        {
+            return m_thumbnail;
+        }
+
+    private:
+        std::shared_ptr<std::vector<uint8_t> const> m_thumbnail;
+    };
+}
+
+int main(int argc, char* argv[])
+{
+    auto accessCount = (argc > 1) ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 100u;
+
+    std::vector<uint8_t> image(ThumbnailSize);
+    std::iota(image.begin(), image.end(), static_cast<uint8_t>(0));
+
+    uint64_t copyingSum = 0;
+    auto copyingTime = MeasureMicroseconds([&]() {
+        CopyingThumbnailResult result{ image };
+        copyingSum = 0;
+        for (uint32_t i = 0; i < accessCount; i++)
+        {
+            auto bytes = result.ThumbnailInBytes();
+            copyingSum += bytes[i % bytes.size()];
+        }
+    });
+
+    uint64_t sharedSum = 0;
+    auto sharedTime = MeasureMicroseconds([&]() {
+        SharedThumbnailResult result{ image };
+        sharedSum = 0;
+        for (uint32_t i = 0; i < accessCount; i++)
+        {
+            auto buffer = result.Thumbnail();
+            sharedSum += (*buffer)[i % buffer->size()];
+        }
+    });
+
+    if (copyingSum != sharedSum)
+    {
+        std::fprintf(stderr, "The two paths didn't return the same image.\n");
+        return EXIT_FAILURE;
+    }
+
+    std::printf("thumbnail size:          %zu bytes\n", ThumbnailSize);
+    std::printf("accesses per result:     %u\n", accessCount);
+    std::printf("copy on every access:    %.1f us\n", copyingTime);
+    std::printf("copy once, share buffer: %.1f us\n", sharedTime);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,339 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "TestHelpers.h"
+#include "ConfigurationFileValidation.h"
+
+using namespace winrt::Microsoft::Windows::DevHome::SDK::implementation;
+
+namespace
+{
+    using Node = ConfigurationYamlNode;
+
+    // Wraps the lines of a unit's settings, indented by eight spaces, in a valid configuration file.
+    std::wstring WithSettings(std::wstring_view settings)
+    {
+        return L"properties:\n"
+               L"  configurationVersion: 0.2.0\n"
+               L"  resources:\n"
+               L"    - resource: Microsoft.WinGet.DSC/WinGetPackage\n"
+               L"      settings:\n" +
+               std::wstring{ settings };
+    }
+
+    // Parses a file that must be valid and returns the settings of its first unit.
+    Node ParseSettings(std::wstring_view settings)
+    {
+        auto file = ConfigurationFile::Parse(WithSettings(settings));
+        if (file.Error() || file.Units().empty())
+        {
+            return Node{};
+        }
+
+        return file.Units()[0].settings;
+    }
+
+    std::wstring GetValue(Node const& node, std::wstring_view key)
+    {
+        auto value = node.Find(key);
+        return value ? value->value : L"<missing>";
+    }
+
+    bool HasError(std::wstring_view text, int32_t resultCode, uint32_t line = 0, bool isUnsupported = false)
+    {
+        auto file = ConfigurationFile::Parse(text);
+        auto const& error = file.Error();
+        return error && (error->resultCode == resultCode) && ((line == 0) || (error->line == line)) &&
+            (error->isUnsupported == isUnsupported) && file.Units().empty();
+    }
+
+    bool IsValid(std::wstring_view text)
+    {
+        return !ConfigurationFile::Parse(text).Error();
+    }
+}
+
+TEST_CASE(CompleteFileIsParsed)
+{
+    auto file = ConfigurationFile::Parse(LR"(# yaml-language-server: $schema=https://aka.ms/configuration-dsc-schema/0.2
+properties:
+  assertions:
+    - resource: Microsoft.Windows.Developer/OsVersion
+      directives:
+        description: Verify min OS version requirement
+        allowPrerelease: true
+      settings:
+        MinVersion: '10.0.22000'
+  resources:
+    - resource: Microsoft.Windows.Developer/DeveloperMode
+      id: devmode
+      settings:
+        Ensure: Present
+    - resource: Microsoft.WinGet.DSC/WinGetPackage
+      id: vs
+      dependsOn:
+        - devmode
+      settings:
+        id: Microsoft.VisualStudio.2022.Community
+  configurationVersion: 0.2.0
+)");
+    REQUIRE(!file.Error());
+    CHECK(file.ConfigurationVersion() == L"0.2.0");
+    REQUIRE(file.Units().size() == 3);
+
+    auto const& assertion = file.Units()[0];
+    CHECK(assertion.isAssertion);
+    CHECK(assertion.resource == L"Microsoft.Windows.Developer/OsVersion");
+    CHECK(assertion.settings.Find(L"MinVersion")->GetScalarType() == Node::ScalarType::String);
+
+    auto const& package = file.Units()[2];
+    CHECK(!package.isAssertion);
+    CHECK(package.identifier == L"vs");
+    CHECK((package.dependsOn == std::vector<std::wstring>{ L"devmode" }));
+    CHECK(GetValue(package.settings, L"id") == L"Microsoft.VisualStudio.2022.Community");
+}
+
+TEST_CASE(BlockSequencesAreParsed)
+{
+    auto settings = ParseSettings(L"        list:\n"
+                                  L"          - 1\n"
+                                  L"          -\n"
+                                  L"            nested: value\n"
+                                  L"          - - a\n"
+                                  L"            - b\n");
+    auto list = settings.Find(L"list");
+    REQUIRE(list && list->kind == Node::Kind::Sequence);
+    REQUIRE(list->items.size() == 3);
+    CHECK(list->items[0].GetInteger() == 1);
+    CHECK(GetValue(list->items[1], L"nested") == L"value");
+    CHECK(list->items[2].items.size() == 2);
+}
+
+TEST_CASE(CompactSequencesEndAtTheNextKey)
+{
+    // Sequences indented like their key end at the next key of the same mapping.
+    auto file = ConfigurationFile::Parse(L"properties:\n"
+                                         L"  resources:\n"
+                                         L"  - resource: A/B\n"
+                                         L"    id: b\n"
+                                         L"  - resource: A/C\n"
+                                         L"    dependsOn:\n"
+                                         L"    - b\n"
+                                         L"    directives:\n"
+                                         L"      description: C\n"
+                                         L"    settings:\n"
+                                         L"      list:\n"
+                                         L"      - 1\n"
+                                         L"      - 2\n"
+                                         L"      after: 3\n"
+                                         L"  configurationVersion: 0.2.0\n");
+    REQUIRE(!file.Error());
+    CHECK(file.ConfigurationVersion() == L"0.2.0");
+    REQUIRE(file.Units().size() == 2);
+    CHECK((file.Units()[1].dependsOn == std::vector<std::wstring>{ L"b" }));
+
+    auto const& settings = file.Units()[1].settings;
+    CHECK(settings.Find(L"list")->items.size() == 2);
+    CHECK(GetValue(settings, L"after") == L"3");
+
+    // The examples the parser used to reject.
+    CHECK(IsValid(L"properties:\n  resources:\n  - resource: A/B\n  configurationVersion: 0.2.0\n"));
+    CHECK(IsValid(L"properties:\n  configurationVersion: 0.2.0\n  resources:\n    - resource: A/B\n      id: x\n    - resource: A/C\n      dependsOn:\n      - x\n      directives:\n        description: C\n"));
+
+    // A line indented less than the sequence, but more than its key, belongs to neither.
+    CHECK(HasError(L"properties:\n  resources:\n    - resource: A/B\n   configurationVersion: 0.2.0\n", ConfigurationFileErrorCode::InvalidYaml, 4));
+}
+
+TEST_CASE(FlowCollectionsAreParsed)
+{
+    auto settings = ParseSettings(L"        flags: [a, \"b, c\", 3, [4, 5], {}]\n"
+                                  L"        map: { x: 1, y: two, z: [ ] }\n"
+                                  L"        empty: []\n");
+    auto flags = settings.Find(L"flags");
+    REQUIRE(flags && flags->kind == Node::Kind::Sequence);
+    REQUIRE(flags->items.size() == 5);
+    CHECK(flags->items[1].value == L"b, c");
+    CHECK(flags->items[3].items.size() == 2);
+    CHECK(flags->items[4].kind == Node::Kind::Mapping);
+
+    auto map = settings.Find(L"map");
+    REQUIRE(map && map->kind == Node::Kind::Mapping);
+    CHECK(GetValue(*map, L"y") == L"two");
+    CHECK(map->Find(L"z")->kind == Node::Kind::Sequence);
+    CHECK(settings.Find(L"empty")->items.empty());
+
+    CHECK(HasError(WithSettings(L"        flags: [a, b\n"), ConfigurationFileErrorCode::InvalidYaml, 6, true));
+    CHECK(HasError(WithSettings(L"        flags: [a] b\n"), ConfigurationFileErrorCode::InvalidYaml, 6));
+}
+
+TEST_CASE(BlockScalarsAreParsed)
+{
+    auto settings = ParseSettings(L"        literal: |\n"
+                                  L"          line one\n"
+                                  L"            indented # not a comment\n"
+                                  L"\n"
+                                  L"          line two\n"
+                                  L"        folded: >-\n"
+                                  L"          a\n"
+                                  L"          b\n"
+                                  L"        kept: |+\n"
+                                  L"          text\n"
+                                  L"\n"
+                                  L"        stripped: |-\n"
+                                  L"          text\n"
+                                  L"        after: value\n");
+    CHECK(GetValue(settings, L"literal") == L"line one\n  indented # not a comment\n\nline two\n");
+    CHECK(GetValue(settings, L"folded") == L"a b");
+    CHECK(GetValue(settings, L"kept") == L"text\n\n");
+    CHECK(GetValue(settings, L"stripped") == L"text");
+    CHECK(GetValue(settings, L"after") == L"value");
+}
+
+TEST_CASE(PlainScalarsContinueOnIndentedLines)
+{
+    auto settings = ParseSettings(L"        plain: this is\n"
+                                  L"          continued\n"
+                                  L"        empty:\n"
+                                  L"        next: 1\n");
+    CHECK(GetValue(settings, L"plain") == L"this is continued");
+    CHECK(settings.Find(L"empty")->kind == Node::Kind::Null);
+    CHECK(settings.Find(L"next")->GetInteger() == 1);
+}
+
+TEST_CASE(QuotedScalarsAreStrings)
+{
+    auto settings = ParseSettings(L"        single: 'it''s # not a comment'\n"
+                                  L"        double: \"tab\\tquote\\\" \\u00e9\"\n"
+                                  L"        number: '10'\n"
+                                  L"        boolean: \"true\"\n");
+    CHECK(GetValue(settings, L"single") == L"it's # not a comment");
+    CHECK(GetValue(settings, L"double") == L"tab\tquote\" \u00e9");
+    CHECK(settings.Find(L"number")->GetScalarType() == Node::ScalarType::String);
+    CHECK(settings.Find(L"boolean")->GetScalarType() == Node::ScalarType::String);
+}
+
+TEST_CASE(ScalarTypesFollowTheCoreSchema)
+{
+    auto settings = ParseSettings(L"        hex: 0x10\n"
+                                  L"        negative: -42\n"
+                                  L"        float: 1.5e3\n"
+                                  L"        infinity: .inf\n"
+                                  L"        boolean: True\n"
+                                  L"        null: ~\n"
+                                  L"        version: 10.0.22000\n");
+    CHECK(settings.Find(L"hex")->GetInteger() == 16);
+    CHECK(settings.Find(L"negative")->GetInteger() == -42);
+    CHECK(settings.Find(L"float")->GetScalarType() == Node::ScalarType::Float);
+    CHECK(settings.Find(L"infinity")->GetScalarType() == Node::ScalarType::Float);
+    CHECK(settings.Find(L"boolean")->GetBoolean());
+    CHECK(settings.Find(L"null")->GetScalarType() == Node::ScalarType::Null);
+    CHECK(settings.Find(L"version")->GetScalarType() == Node::ScalarType::String);
+}
+
+TEST_CASE(CommentsAreIgnored)
+{
+    auto settings = ParseSettings(L"        # a comment line\n"
+                                  L"        apostrophe: it's fine # comment\n"
+                                  L"        url: https://x.y/z#fragment\n"
+                                  L"          # an indented comment\n"
+                                  L"        last: value#not a comment\n");
+    CHECK(GetValue(settings, L"apostrophe") == L"it's fine");
+    CHECK(GetValue(settings, L"url") == L"https://x.y/z#fragment");
+    CHECK(GetValue(settings, L"last") == L"value#not a comment");
+}
+
+TEST_CASE(DocumentMarkersLineEndingsAndByteOrderMarksAreHandled)
+{
+    CHECK(IsValid(L"---\nproperties:\n  configurationVersion: 0.2.0\n...\n"));
+    CHECK(IsValid(L"\xFEFFproperties:\r\n  configurationVersion: 0.1\r\n  resources:\r\n  - resource: x/y\r\n    settings:\r\n      a: 'b'\r\n"));
+    CHECK(HasError(L"---\nproperties:\n  configurationVersion: 0.2\n---\nfoo: 1\n", ConfigurationFileErrorCode::InvalidYaml, 4, true));
+}
+
+TEST_CASE(InvalidConfigurationFileIsReported)
+{
+    CHECK(HasError(L"", ConfigurationFileErrorCode::InvalidConfigurationFile));
+    CHECK(HasError(L"hello\n", ConfigurationFileErrorCode::InvalidConfigurationFile, 1));
+    CHECK(HasError(L"- a\n", ConfigurationFileErrorCode::InvalidConfigurationFile, 1));
+}
+
+TEST_CASE(InvalidYamlIsReported)
+{
+    CHECK(HasError(L"properties:\n\tconfigurationVersion: 0.2\n", ConfigurationFileErrorCode::InvalidYaml, 2));
+    CHECK(HasError(L"properties:\n  configurationVersion: 0.2\n  configurationVersion: 0.2\n", ConfigurationFileErrorCode::InvalidYaml, 3));
+    CHECK(HasError(L"properties:\n  configurationVersion: 0.2\n   foo: 1\n", ConfigurationFileErrorCode::InvalidYaml, 3));
+    CHECK(HasError(WithSettings(L"        x: {a: 1, a: 2}\n"), ConfigurationFileErrorCode::InvalidYaml, 6));
+    CHECK(HasError(WithSettings(L"        x: [{a: 1}, {b: {c: 1, 'c': 2}}]\n"), ConfigurationFileErrorCode::InvalidYaml, 6));
+    CHECK(HasError(WithSettings(L"        a: 'unclosed\n"), ConfigurationFileErrorCode::InvalidYaml, 6, true));
+    CHECK(HasError(WithSettings(L"        a: &anchor 1\n"), ConfigurationFileErrorCode::InvalidYaml, 6, true));
+    CHECK(HasError(WithSettings(L"        ? complex: 1\n"), ConfigurationFileErrorCode::InvalidYaml, 6, true));
+    CHECK(HasError(L"$schema: https://aka.ms/configuration-dsc-schema/0.3\nresources: []\n", ConfigurationFileErrorCode::InvalidYaml, 1, true));
+}
+
+TEST_CASE(DeeplyNestedNodesAreUnsupported)
+{
+    CHECK(HasError(WithSettings(L"        a: " + std::wstring(200000, L'[') + L"\n"), ConfigurationFileErrorCode::InvalidYaml, 6, true));
+    CHECK(HasError(WithSettings(L"        a: " + std::wstring(200000, L'{') + L"\n"), ConfigurationFileErrorCode::InvalidYaml, 6, true));
+
+    std::wstring sequences;
+    for (size_t i = 0; i < 100000; i++)
+    {
+        sequences += L"- ";
+    }
+
+    CHECK(HasError(WithSettings(L"        a:\n          " + sequences + L"x\n"), ConfigurationFileErrorCode::InvalidYaml, 7, true));
+
+    std::wstring mappings;
+    for (size_t i = 0; i < 1000; i++)
+    {
+        mappings += std::wstring(8 + i, L' ') + L"a:\n";
+    }
+
+    CHECK(HasError(WithSettings(mappings), ConfigurationFileErrorCode::InvalidYaml, 0, true));
+
+    auto nested = ParseSettings(L"        a: " + std::wstring(200, L'[') + std::wstring(200, L']') + L"\n");
+    CHECK(nested.Find(L"a") && nested.Find(L"a")->kind == Node::Kind::Sequence);
+}
+
+TEST_CASE(InvalidFieldTypeIsReported)
+{
+    CHECK(HasError(L"properties:\n  configurationVersion: 0.2\n  resources:\n    - resource: a\n      settings: [1]\n", ConfigurationFileErrorCode::InvalidFieldType, 5));
+    CHECK(HasError(L"properties:\n  configurationVersion: 0.2\n  resources: a\n", ConfigurationFileErrorCode::InvalidFieldType, 3));
+}
+
+TEST_CASE(UnknownConfigurationFileVersionIsReported)
+{
+    CHECK(HasError(L"properties:\n  configurationVersion: 0.5\n", ConfigurationFileErrorCode::UnknownConfigurationFileVersion, 2));
+}
+
+TEST_CASE(DuplicateIdentifierIsReported)
+{
+    CHECK(HasError(L"properties:\n  configurationVersion: 0.2\n  resources:\n    - resource: a/b\n      id: x\n    - resource: a/c\n      id: x\n", ConfigurationFileErrorCode::DuplicateIdentifier, 7));
+}
+
+TEST_CASE(MissingDependencyIsReported)
+{
+    CHECK(HasError(L"properties:\n  configurationVersion: 0.2\n  resources:\n    - resource: a/b\n      dependsOn: [y]\n", ConfigurationFileErrorCode::MissingDependency, 5));
+}
+
+TEST_CASE(DependencyCycleIsReported)
+{
+    CHECK(HasError(L"properties:\n  configurationVersion: 0.2\n  resources:\n    - resource: a/b\n      id: x\n      dependsOn: [y]\n    - resource: a/c\n      id: y\n      dependsOn:\n        - x\n", ConfigurationFileErrorCode::DependencyCycle));
+    CHECK(HasError(L"properties:\n  configurationVersion: 0.2\n  resources:\n    - resource: a/b\n      id: x\n      dependsOn: [x]\n", ConfigurationFileErrorCode::DependencyCycle, 6));
+}
+
+TEST_CASE(InvalidFieldValueIsReported)
+{
+    CHECK(HasError(L"properties:\n  configurationVersion: 0.2\n  resources:\n    - resource: a/b/c\n", ConfigurationFileErrorCode::InvalidFieldValue, 4));
+}
+
+TEST_CASE(MissingFieldIsReported)
+{
+    CHECK(HasError(L"foo: 1\n", ConfigurationFileErrorCode::MissingField, 1));
+    CHECK(HasError(L"properties:\n  configurationVersion: 0.2\n  resources:\n    - id: a\n", ConfigurationFileErrorCode::MissingField, 4));
+}
+
+int main()
+{
+    return PortableTests::RunTests();
+}
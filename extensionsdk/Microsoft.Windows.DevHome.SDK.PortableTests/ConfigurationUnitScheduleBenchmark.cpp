@@ -0,0 +1,155 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+// Measures the scheduling work ConfigurationApplyScheduler does around the units it applies: building the
+// dependency graph of a set, then starting and completing every unit with a fixed number of units in progress.
+// The units complete in the order they started and take no time, so only the scheduling is measured.
+//
+// Usage: ConfigurationUnitScheduleBenchmark [unit count]
+
+#include "pch.h"
+#include "ConfigurationUnitSchedule.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+
+using namespace winrt::Microsoft::Windows::DevHome::SDK::implementation;
+
+namespace
+{
+    constexpr int Iterations = 10;
+    constexpr uint32_t MaxConcurrentUnits = 8;
+
+    template <typename Function>
+    double MeasureMicroseconds(Function&& function)
+    {
+        auto best = std::chrono::steady_clock::duration::max();
+        for (int i = 0; i < Iterations; i++)
+        {
+            auto start = std::chrono::steady_clock::now();
+            function();
+            best = std::min(best, std::chrono::steady_clock::now() - start);
+        }
+
+        return std::chrono::duration<double, std::micro>(best).count();
+    }
+
+    // Every unit depends on up to dependencyCount of the units added before it, chosen by a fixed generator so
+    // every run measures the same set. Every assertionInterval-th unit is an assertion without dependencies.
+    std::vector<ConfigurationScheduledUnit> CreateUnits(uint32_t unitCount, uint32_t dependencyCount, uint32_t assertionInterval)
+    {
+        uint32_t random = 12345;
+        auto nextRandom = [&random]() {
+            random = random * 1103515245u + 12345u;
+            return random >> 8;
+        };
+
+        std::vector<ConfigurationScheduledUnit> units(unitCount);
+        for (uint32_t i = 0; i < unitCount; i++)
+        {
+            units[i].identifier = L"unit" + std::to_wstring(i);
+            units[i].isAssert = (assertionInterval != 0) && (i % assertionInterval == 0);
+            if (units[i].isAssert)
+            {
+                continue;
+            }
+
+            for (uint32_t j = 0; j < dependencyCount && i > 0; j++)
+            {
+                auto dependency = nextRandom() % i;
+                auto const& identifier = units[dependency].identifier;
+                auto& dependsOn = units[i].dependsOn;
+                if (std::find(dependsOn.begin(), dependsOn.end(), identifier) == dependsOn.end())
+                {
+                    dependsOn.push_back(identifier);
+                }
+            }
+        }
+
+        return units;
+    }
+
+    // Every failureInterval-th unit fails, starting with the last unit of the first interval. Returns the number
+    // of units that were started.
+    uint32_t Run(ConfigurationUnitSchedule& schedule, uint32_t failureInterval)
+    {
+        std::deque<uint32_t> activeUnits;
+        std::vector<uint32_t> skippedUnits;
+        uint32_t startedCount = 0;
+        while (!schedule.IsCompleted())
+        {
+            while (activeUnits.size() < MaxConcurrentUnits)
+            {
+                auto unitIndex = schedule.TryStartNext();
+                if (!unitIndex)
+                {
+                    break;
+                }
+
+                activeUnits.push_back(*unitIndex);
+                startedCount++;
+            }
+
+            if (activeUnits.empty())
+            {
+                break;
+            }
+
+            auto unitIndex = activeUnits.front();
+            activeUnits.pop_front();
+            skippedUnits.clear();
+            schedule.Complete(unitIndex, (failureInterval == 0) || (unitIndex % failureInterval != failureInterval - 1), skippedUnits);
+        }
+
+        return startedCount;
+    }
+
+    bool Measure(char const* name, std::vector<ConfigurationScheduledUnit> const& units, uint32_t failureInterval)
+    {
+        auto buildTime = MeasureMicroseconds([&]() {
+            ConfigurationUnitSchedule schedule{ units };
+        });
+
+        bool isCompleted = true;
+        uint32_t startedCount = 0;
+        auto runTime = MeasureMicroseconds([&]() {
+            ConfigurationUnitSchedule schedule{ units };
+            startedCount = Run(schedule, failureInterval);
+            isCompleted = isCompleted && !schedule.Error() && schedule.IsCompleted();
+        });
+
+        std::printf("%-34s build %10.1f us, run %10.1f us, %u of %zu units started\n", name, buildTime, runTime, startedCount, units.size());
+        return isCompleted;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    auto unitCount = (argc > 1) ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 10000u;
+
+    std::vector<ConfigurationScheduledUnit> chain(unitCount);
+    for (uint32_t i = 0; i < unitCount; i++)
+    {
+        chain[i].identifier = L"unit" + std::to_wstring(i);
+        if (i > 0)
+        {
+            chain[i].dependsOn.push_back(chain[i - 1].identifier);
+        }
+    }
+
+    auto isCompleted = true;
+    isCompleted = Measure("independent units", CreateUnits(unitCount, 0, 0), 0) && isCompleted;
+    isCompleted = Measure("chain", chain, 0) && isCompleted;
+    isCompleted = Measure("4 dependencies per unit", CreateUnits(unitCount, 4, 0), 0) && isCompleted;
+    isCompleted = Measure("4 dependencies, 1% assertions", CreateUnits(unitCount, 4, 100), 0) && isCompleted;
+    isCompleted = Measure("4 dependencies, 1% failures", CreateUnits(unitCount, 4, 0), 100) && isCompleted;
+    if (!isCompleted)
+    {
+        std::fprintf(stderr, "A schedule didn't complete.\n");
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,175 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "TestHelpers.h"
+#include "ConfigurationUnitSchedule.h"
+
+using namespace winrt::Microsoft::Windows::DevHome::SDK::implementation;
+
+namespace
+{
+    ConfigurationScheduledUnit Unit(std::wstring identifier, std::vector<std::wstring> dependsOn = {})
+    {
+        return ConfigurationScheduledUnit{ std::move(identifier), false, std::move(dependsOn) };
+    }
+
+    ConfigurationScheduledUnit Assertion(std::wstring identifier, std::vector<std::wstring> dependsOn = {})
+    {
+        return ConfigurationScheduledUnit{ std::move(identifier), true, std::move(dependsOn) };
+    }
+
+    // Starts every ready unit.
+    std::vector<uint32_t> StartAll(ConfigurationUnitSchedule& schedule)
+    {
+        std::vector<uint32_t> startedUnits;
+        while (auto unitIndex = schedule.TryStartNext())
+        {
+            startedUnits.push_back(*unitIndex);
+        }
+
+        return startedUnits;
+    }
+
+    std::vector<uint32_t> Complete(ConfigurationUnitSchedule& schedule, uint32_t unitIndex, bool isSuccessful = true)
+    {
+        std::vector<uint32_t> skippedUnits;
+        schedule.Complete(unitIndex, isSuccessful, skippedUnits);
+        return skippedUnits;
+    }
+
+    bool HasError(std::vector<ConfigurationScheduledUnit> const& units, std::wstring_view expectedText)
+    {
+        ConfigurationUnitSchedule schedule{ units };
+        return schedule.Error() && (schedule.Error()->find(expectedText) != std::wstring::npos) && !schedule.TryStartNext();
+    }
+}
+
+TEST_CASE(InvalidDependenciesAreReported)
+{
+    CHECK(HasError({ Unit(L"a"), Unit(L"a") }, L"More than one unit has the identifier 'a'."));
+    CHECK(HasError({ Unit(L"a", { L"b" }) }, L"The unit 'a' depends on 'b', which doesn't exist."));
+    CHECK(HasError({ Unit(L"a"), Assertion(L"b", { L"a" }) }, L"The assertion 'b' depends on 'a', which isn't an assertion."));
+    CHECK(HasError({ Unit(L"a", { L"c" }), Unit(L"b", { L"a" }), Unit(L"c", { L"b" }), Unit(L"d") }, L"cycle"));
+    CHECK(HasError({ Unit(L"a", { L"a" }) }, L"cycle"));
+
+    // Units without an identifier can't be depended on.
+    CHECK(HasError({ Unit(L""), Unit(L"b", { L"" }) }, L"doesn't exist"));
+}
+
+TEST_CASE(UnitsWithoutIdentifiersAreScheduled)
+{
+    ConfigurationUnitSchedule schedule{ { Unit(L""), Unit(L"") } };
+    CHECK(!schedule.Error());
+    CHECK((StartAll(schedule) == std::vector<uint32_t>{ 0, 1 }));
+}
+
+TEST_CASE(EmptyScheduleIsCompleted)
+{
+    ConfigurationUnitSchedule schedule{ {} };
+    CHECK(!schedule.Error());
+    CHECK(schedule.IsCompleted());
+    CHECK(!schedule.TryStartNext());
+}
+
+TEST_CASE(ReadyUnitsStartInTheOrderTheyWereAdded)
+{
+    ConfigurationUnitSchedule schedule{ { Unit(L"a", { L"d" }), Unit(L"b"), Unit(L"c"), Unit(L"d") } };
+    REQUIRE(!schedule.Error());
+    CHECK(schedule.TryStartNext() == 1u);
+    CHECK(schedule.TryStartNext() == 2u);
+    CHECK(schedule.TryStartNext() == 3u);
+    CHECK(!schedule.TryStartNext());
+
+    CHECK(Complete(schedule, 3).empty());
+    CHECK(schedule.TryStartNext() == 0u);
+    CHECK(!schedule.IsCompleted());
+
+    Complete(schedule, 0);
+    Complete(schedule, 1);
+    Complete(schedule, 2);
+    CHECK(schedule.IsCompleted());
+}
+
+TEST_CASE(UnitsWaitForEveryDependency)
+{
+    ConfigurationUnitSchedule schedule{ { Unit(L"a"), Unit(L"b"), Unit(L"c", { L"a", L"b" }) } };
+    REQUIRE(!schedule.Error());
+    CHECK((StartAll(schedule) == std::vector<uint32_t>{ 0, 1 }));
+
+    Complete(schedule, 1);
+    CHECK(!schedule.TryStartNext());
+
+    Complete(schedule, 0);
+    CHECK(schedule.TryStartNext() == 2u);
+}
+
+TEST_CASE(AssertionsRunBeforeOtherUnits)
+{
+    ConfigurationUnitSchedule schedule{ { Unit(L"a"), Assertion(L"b"), Assertion(L"c", { L"b" }), Unit(L"d", { L"c" }) } };
+    REQUIRE(!schedule.Error());
+    CHECK((StartAll(schedule) == std::vector<uint32_t>{ 1 }));
+
+    Complete(schedule, 1);
+    CHECK((StartAll(schedule) == std::vector<uint32_t>{ 2 }));
+
+    Complete(schedule, 2);
+    CHECK((StartAll(schedule) == std::vector<uint32_t>{ 0, 3 }));
+}
+
+TEST_CASE(FailedAssertionsStillLetOtherUnitsRun)
+{
+    ConfigurationUnitSchedule schedule{ { Unit(L"a"), Assertion(L"b"), Unit(L"c", { L"b" }) } };
+    REQUIRE(!schedule.Error());
+    CHECK((StartAll(schedule) == std::vector<uint32_t>{ 1 }));
+    CHECK((Complete(schedule, 1, false) == std::vector<uint32_t>{ 2 }));
+    CHECK((StartAll(schedule) == std::vector<uint32_t>{ 0 }));
+}
+
+TEST_CASE(FailuresSkipEveryDependentUnitOnce)
+{
+    // b and c depend on a, d depends on b and c, and e depends on d. f doesn't depend on a.
+    ConfigurationUnitSchedule schedule{ {
+        Unit(L"a"),
+        Unit(L"b", { L"a" }),
+        Unit(L"c", { L"a" }),
+        Unit(L"d", { L"b", L"c" }),
+        Unit(L"e", { L"d" }),
+        Unit(L"f"),
+    } };
+    REQUIRE(!schedule.Error());
+    CHECK((StartAll(schedule) == std::vector<uint32_t>{ 0, 5 }));
+
+    auto skippedUnits = Complete(schedule, 0, false);
+    std::vector<uint32_t> sortedUnits = skippedUnits;
+    std::sort(sortedUnits.begin(), sortedUnits.end());
+    CHECK((sortedUnits == std::vector<uint32_t>{ 1, 2, 3, 4 }));
+
+    // A unit is skipped after the unit that caused it to be skipped.
+    auto position = [&skippedUnits](uint32_t unitIndex) {
+        return std::find(skippedUnits.begin(), skippedUnits.end(), unitIndex) - skippedUnits.begin();
+    };
+    CHECK(position(4) > position(3));
+    CHECK(position(3) > std::min(position(1), position(2)));
+
+    CHECK(!schedule.TryStartNext());
+    CHECK(!schedule.IsCompleted());
+    Complete(schedule, 5);
+    CHECK(schedule.IsCompleted());
+}
+
+TEST_CASE(UnitsReadyAfterAnotherDependencyFailsAreSkipped)
+{
+    ConfigurationUnitSchedule schedule{ { Unit(L"a"), Unit(L"b"), Unit(L"c", { L"a", L"b" }) } };
+    REQUIRE(!schedule.Error());
+    StartAll(schedule);
+    CHECK(Complete(schedule, 0).empty());
+    CHECK((Complete(schedule, 1, false) == std::vector<uint32_t>{ 2 }));
+    CHECK(!schedule.TryStartNext());
+    CHECK(schedule.IsCompleted());
+}
+
+int main()
+{
+    return PortableTests::RunTests();
+}
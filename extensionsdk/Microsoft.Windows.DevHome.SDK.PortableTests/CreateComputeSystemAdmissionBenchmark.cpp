@@ -0,0 +1,83 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+// Measures the admission work CreateComputeSystemQueue does under its lock: queuing every creation, then
+// completing them one at a time in the order they were admitted, admitting waiting creations and reporting the
+// changed queue positions after every change. Creations ask for different amounts of memory and disk
+// bandwidth, so both budgets limit the admitted creations.
+//
+// Usage: CreateComputeSystemAdmissionBenchmark [creation count]
+
+#include "pch.h"
+#include "CreateComputeSystemAdmission.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace winrt::Microsoft::Windows::DevHome::SDK::implementation;
+
+namespace
+{
+    constexpr int Iterations = 10;
+    constexpr uint64_t Gigabyte = 1024ull * 1024 * 1024;
+    constexpr uint64_t MegabytePerSecond = 1024ull * 1024;
+
+    template <typename Function>
+    double MeasureMicroseconds(Function&& function)
+    {
+        auto best = std::chrono::steady_clock::duration::max();
+        for (int i = 0; i < Iterations; i++)
+        {
+            auto start = std::chrono::steady_clock::now();
+            function();
+            best = std::min(best, std::chrono::steady_clock::now() - start);
+        }
+
+        return std::chrono::duration<double, std::micro>(best).count();
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    auto creationCount = (argc > 1) ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 1000u;
+
+    size_t reportedPositions = 0;
+    uint32_t admittedCount = 0;
+    auto time = MeasureMicroseconds([&]() {
+        CreateComputeSystemAdmission admission{ 4, 32 * Gigabyte, 800 * MegabytePerSecond };
+        std::vector<uint64_t> admittedIds;
+        std::vector<std::pair<uint64_t, uint32_t>> changedPositions;
+        reportedPositions = 0;
+        admittedCount = 0;
+
+        for (uint32_t i = 0; i < creationCount; i++)
+        {
+            admission.Enter((4 + (i % 4) * 4) * Gigabyte, (100 + (i % 3) * 150) * MegabytePerSecond);
+            admission.AdmitWaiting(admittedIds, changedPositions);
+            reportedPositions += changedPositions.size();
+            changedPositions.clear();
+        }
+
+        for (size_t next = 0; next < admittedIds.size(); next++)
+        {
+            admission.Leave(admittedIds[next]);
+            admission.AdmitWaiting(admittedIds, changedPositions);
+            reportedPositions += changedPositions.size();
+            changedPositions.clear();
+        }
+
+        admittedCount = static_cast<uint32_t>(admittedIds.size());
+    });
+
+    if (admittedCount != creationCount)
+    {
+        std::fprintf(stderr, "Not every creation was admitted.\n");
+        return EXIT_FAILURE;
+    }
+
+    std::printf("creations:          %u\n", creationCount);
+    std::printf("reported positions: %zu\n", reportedPositions);
+    std::printf("queue and complete: %.1f us, %.2f us per creation\n", time, time / creationCount);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,137 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "TestHelpers.h"
+#include "CreateComputeSystemAdmission.h"
+
+using namespace winrt::Microsoft::Windows::DevHome::SDK::implementation;
+
+namespace
+{
+    using Ids = std::vector<uint64_t>;
+    using Positions = std::vector<std::pair<uint64_t, uint32_t>>;
+
+    Ids Admit(CreateComputeSystemAdmission& admission, Positions* changedPositions = nullptr)
+    {
+        Ids admittedIds;
+        Positions positions;
+        admission.AdmitWaiting(admittedIds, positions);
+        if (changedPositions)
+        {
+            *changedPositions = std::move(positions);
+        }
+
+        return admittedIds;
+    }
+}
+
+TEST_CASE(CreationsAreLimitedByCount)
+{
+    CreateComputeSystemAdmission admission{ 2, 0, 0 };
+    auto first = admission.Enter(100, 100);
+    auto second = admission.Enter(100, 100);
+    auto third = admission.Enter(100, 100);
+
+    Positions positions;
+    CHECK((Admit(admission, &positions) == Ids{ first, second }));
+    CHECK((positions == Positions{ { third, 1 } }));
+    CHECK(admission.ActiveCreations() == 2);
+    CHECK(admission.WaitingCreations() == 1);
+
+    CHECK(admission.Leave(first));
+    CHECK((Admit(admission) == Ids{ third }));
+}
+
+TEST_CASE(CreationsAreLimitedByBudgets)
+{
+    CreateComputeSystemAdmission admission{ 10, 1000, 50 };
+    auto first = admission.Enter(600, 10);
+    auto second = admission.Enter(400, 40);
+    auto third = admission.Enter(1, 0);
+    auto fourth = admission.Enter(0, 1);
+    CHECK((Admit(admission) == Ids{ first, second }));
+
+    // The memory budget is used up by the first two, and the disk bandwidth budget as well.
+    CHECK(admission.Leave(second));
+    CHECK((Admit(admission) == Ids{ third, fourth }));
+}
+
+TEST_CASE(LargeCreationsAreNotStarved)
+{
+    CreateComputeSystemAdmission admission{ 10, 1000, 0 };
+    auto first = admission.Enter(500, 0);
+    auto large = admission.Enter(800, 0);
+    auto small = admission.Enter(100, 0);
+
+    // The small creation would fit, but waits behind the large one.
+    Positions positions;
+    CHECK((Admit(admission, &positions) == Ids{ first }));
+    CHECK((positions == Positions{ { large, 1 }, { small, 2 } }));
+
+    CHECK(admission.Leave(first));
+    CHECK((Admit(admission) == Ids{ large, small }));
+}
+
+TEST_CASE(CreationsLargerThanABudgetRunAlone)
+{
+    CreateComputeSystemAdmission admission{ 10, 1000, 100 };
+    auto large = admission.Enter(5000, 0);
+    auto small = admission.Enter(1, 1);
+    CHECK((Admit(admission) == Ids{ large }));
+
+    // The memory in use is over the budget, which must not let the small creation in.
+    CHECK(Admit(admission).empty());
+    CHECK(admission.Leave(large));
+    CHECK((Admit(admission) == Ids{ small }));
+}
+
+TEST_CASE(HugeRequestsDontOverflowTheBudgets)
+{
+    CreateComputeSystemAdmission admission{ 10, 1000, 0 };
+    auto first = admission.Enter(10, 0);
+    admission.Enter(std::numeric_limits<uint64_t>::max(), 0);
+    CHECK((Admit(admission) == Ids{ first }));
+    CHECK(admission.WaitingCreations() == 1);
+}
+
+TEST_CASE(PositionsAreOnlyReportedWhenTheyChange)
+{
+    CreateComputeSystemAdmission admission{ 1, 0, 0 };
+    auto first = admission.Enter(0, 0);
+    auto second = admission.Enter(0, 0);
+    auto third = admission.Enter(0, 0);
+
+    Positions positions;
+    CHECK((Admit(admission, &positions) == Ids{ first }));
+    CHECK((positions == Positions{ { second, 1 }, { third, 2 } }));
+
+    CHECK(Admit(admission, &positions).empty());
+    CHECK(positions.empty());
+
+    // A waiting creation leaving moves the ones behind it.
+    CHECK(admission.Leave(second));
+    CHECK(Admit(admission, &positions).empty());
+    CHECK((positions == Positions{ { third, 1 } }));
+}
+
+TEST_CASE(LeavingTwiceIsIgnored)
+{
+    CreateComputeSystemAdmission admission{ 1, 0, 0 };
+    auto first = admission.Enter(0, 0);
+    auto second = admission.Enter(0, 0);
+    Admit(admission);
+
+    CHECK(admission.Leave(first));
+    CHECK(!admission.Leave(first));
+    CHECK(admission.Leave(second));
+    CHECK(!admission.Leave(second));
+    CHECK(!admission.Leave(0));
+    CHECK(admission.ActiveCreations() == 0);
+    CHECK(admission.WaitingCreations() == 0);
+}
+
+int main()
+{
+    return PortableTests::RunTests();
+}
@@ -0,0 +1,150 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+// Compares the two ways Dev Home can list the repositories of an extension: reading every property of every
+// IRepository, and reading one RepositoryInfosResult.Repositories array. The repositories are modeled with the
+// standard library: a call through the abstract Repository class stands in for a call on IRepository, and
+// copying the RepositoryInfo vector stands in for marshaling the array.
+//
+// Only the work done inside the two processes is timed. The cost of a call across the process boundary needs
+// COM and an out-of-process extension, so it is reported as the number of such calls each path makes.
+//
+// Usage: RepositoryInfoSnapshotBenchmark [repository count]
+
+#include "pch.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+
+namespace
+{
+    constexpr int Iterations = 20;
+
+    template <typename Function>
+    double MeasureMicroseconds(Function&& function)
+    {
+        auto best = std::chrono::steady_clock::duration::max();
+        for (int i = 0; i < Iterations; i++)
+        {
+            auto start = std::chrono::steady_clock::now();
+            function();
+            best = std::min(best, std::chrono::steady_clock::now() - start);
+        }
+
+        return std::chrono::duration<double, std::micro>(best).count();
+    }
+
+    // The fields of the RepositoryInfo struct.
+    struct RepositoryInfo
+    {
+        std::wstring displayName;
+        std::wstring owningAccountName;
+        bool isPrivate{};
+        int64_t lastUpdated{};
+        std::wstring repoUri;
+    };
+
+    // The properties of IRepository that RepositoryInfo carries. Strings are returned by value, as they are
+    // when they are marshaled.
+    class Repository
+    {
+    public:
+        virtual ~Repository() = default;
+        virtual std::wstring DisplayName() const = 0;
+        virtual std::wstring OwningAccountName() const = 0;
+        virtual bool IsPrivate() const = 0;
+        virtual int64_t LastUpdated() const = 0;
+        virtual std::wstring RepoUri() const = 0;
+    };
+
+    class ExtensionRepository : public Repository
+    {
+    public:
+        explicit ExtensionRepository(RepositoryInfo info) :
+            m_info(std::move(info))
+        {
+        }
+
+        std::wstring DisplayName() const override { return m_info.displayName; }
+        std::wstring OwningAccountName() const override { return m_info.owningAccountName; }
+        bool IsPrivate() const override { return m_info.isPrivate; }
+        int64_t LastUpdated() const override { return m_info.lastUpdated; }
+        std::wstring RepoUri() const override { return m_info.repoUri; }
+
+    private:
+        RepositoryInfo m_info;
+    };
+
+    // What RepositoryInfosResult::ToRepositoryInfo does inside the extension.
+    RepositoryInfo ToRepositoryInfo(Repository const& repository)
+    {
+        return RepositoryInfo{
+            repository.DisplayName(),
+            repository.OwningAccountName(),
+            repository.IsPrivate(),
+            repository.LastUpdated(),
+            repository.RepoUri() };
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    auto repositoryCount = (argc > 1) ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 10000u;
+
+    std::vector<std::unique_ptr<Repository>> repositories;
+    for (uint32_t i = 0; i < repositoryCount; i++)
+    {
+        auto name = L"repository-" + std::to_wstring(i);
+        repositories.push_back(std::make_unique<ExtensionRepository>(RepositoryInfo{
+            name, L"developer", (i % 2) == 0, static_cast<int64_t>(i), L"https://github.com/developer/" + name }));
+    }
+
+    // Dev Home reads every property of every repository.
+    size_t interfaceLength = 0;
+    auto interfaceTime = MeasureMicroseconds([&]() {
+        interfaceLength = 0;
+        for (auto const& repository : repositories)
+        {
+            interfaceLength += repository->DisplayName().size();
+            interfaceLength += repository->OwningAccountName().size();
+            interfaceLength += repository->IsPrivate() ? 1 : 0;
+            interfaceLength += static_cast<size_t>(repository->LastUpdated() >= 0);
+            interfaceLength += repository->RepoUri().size();
+        }
+    });
+
+    // The extension builds the snapshot, the array is copied once and Dev Home reads the values.
+    size_t snapshotLength = 0;
+    auto snapshotTime = MeasureMicroseconds([&]() {
+        std::vector<RepositoryInfo> snapshot;
+        snapshot.reserve(repositories.size());
+        for (auto const& repository : repositories)
+        {
+            snapshot.push_back(ToRepositoryInfo(*repository));
+        }
+
+        auto marshaled = snapshot;
+        snapshotLength = 0;
+        for (auto const& info : marshaled)
+        {
+            snapshotLength += info.displayName.size();
+            snapshotLength += info.owningAccountName.size();
+            snapshotLength += info.isPrivate ? 1 : 0;
+            snapshotLength += static_cast<size_t>(info.lastUpdated >= 0);
+            snapshotLength += info.repoUri.size();
+        }
+    });
+
+    if (interfaceLength != snapshotLength)
+    {
+        std::fprintf(stderr, "The two paths didn't read the same repositories.\n");
+        return EXIT_FAILURE;
+    }
+
+    std::printf("repositories:                 %u\n", repositoryCount);
+    std::printf("interface path:               %.1f us, %u cross-process calls\n", interfaceTime, repositoryCount * 5);
+    std::printf("snapshot path:                %.1f us, 1 cross-process call\n", snapshotTime);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,79 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+// Measures how long RepositorySearchSuggestionSession takes to answer a keystroke from its cache: a value that
+// was requested before, a value filtered from the answer for its prefix, and a value that misses and has to go
+// to the provider. The cache is full, with answers for every field and several scopes.
+//
+// Usage: SearchSuggestionCacheBenchmark [suggestions per answer]
+
+#include "pch.h"
+#include "SearchSuggestionCache.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace winrt::Microsoft::Windows::DevHome::SDK::implementation;
+
+namespace
+{
+    constexpr int Iterations = 200;
+
+    template <typename Function>
+    double MeasureMicroseconds(Function&& function)
+    {
+        auto best = std::chrono::steady_clock::duration::max();
+        for (int i = 0; i < Iterations; i++)
+        {
+            auto start = std::chrono::steady_clock::now();
+            function();
+            best = std::min(best, std::chrono::steady_clock::now() - start);
+        }
+
+        return std::chrono::duration<double, std::micro>(best).count();
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    auto suggestionCount = (argc > 1) ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 1000u;
+
+    // The user typed "repo" one character at a time in the name field, after filling in other fields.
+    SearchSuggestionCache cache;
+    std::wstring scope;
+    for (uint32_t i = 0; i < SearchSuggestionCache::MaxEntries; i++)
+    {
+        scope = SearchSuggestionCache::GetScope(L"name", { { L"owner", L"owner-" + std::to_wstring(i / 4) } });
+        std::wstring typedValue = std::wstring(L"repo").substr(0, (i % 4) + 1);
+
+        std::vector<std::wstring> values;
+        for (uint32_t j = 0; j < suggestionCount; j++)
+        {
+            values.push_back(((j % 3 == 0) ? L"Repository-" : L"project-") + std::to_wstring(j));
+        }
+
+        cache.Add(scope, typedValue, std::move(values));
+    }
+
+    size_t exactCount = 0;
+    auto exactTime = MeasureMicroseconds([&]() { exactCount = cache.TryGet(scope, L"repo", true)->size(); });
+
+    size_t filteredCount = 0;
+    auto filteredTime = MeasureMicroseconds([&]() { filteredCount = cache.TryGet(scope, L"repository-1", true)->size(); });
+
+    bool isMissed = false;
+    auto missTime = MeasureMicroseconds([&]() { isMissed = !cache.TryGet(scope, L"xyz", true); });
+
+    if (exactCount != suggestionCount || filteredCount == 0 || filteredCount >= suggestionCount || !isMissed)
+    {
+        std::fprintf(stderr, "The cache didn't return the expected suggestions.\n");
+        return EXIT_FAILURE;
+    }
+
+    std::printf("suggestions per answer:    %u\n", suggestionCount);
+    std::printf("same value:                %.1f us\n", exactTime);
+    std::printf("filtered from the prefix:  %.1f us, %zu suggestions\n", filteredTime, filteredCount);
+    std::printf("miss:                      %.1f us\n", missTime);
+    return EXIT_SUCCESS;
+}
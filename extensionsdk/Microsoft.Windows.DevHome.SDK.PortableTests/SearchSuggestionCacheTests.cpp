@@ -0,0 +1,85 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "TestHelpers.h"
+#include "SearchSuggestionCache.h"
+
+using namespace winrt::Microsoft::Windows::DevHome::SDK::implementation;
+
+namespace
+{
+    using Values = std::vector<std::wstring>;
+}
+
+TEST_CASE(ScopeDependsOnEveryOtherFieldButNotTheirOrder)
+{
+    auto scope = SearchSuggestionCache::GetScope(L"name", { { L"owner", L"contoso" }, { L"language", L"cpp" } });
+    CHECK(scope == SearchSuggestionCache::GetScope(L"name", { { L"language", L"cpp" }, { L"owner", L"contoso" } }));
+    CHECK(scope != SearchSuggestionCache::GetScope(L"name", { { L"owner", L"contoso" } }));
+    CHECK(scope != SearchSuggestionCache::GetScope(L"owner", { { L"name", L"contoso" }, { L"language", L"cpp" } }));
+
+    // The separators keep names and values from running into each other.
+    CHECK(SearchSuggestionCache::GetScope(L"name", { { L"ab", L"c" } }) != SearchSuggestionCache::GetScope(L"name", { { L"a", L"bc" } }));
+}
+
+TEST_CASE(SameValueIsReused)
+{
+    SearchSuggestionCache cache;
+    CHECK(!cache.TryGet(L"scope", L"de", true));
+
+    cache.Add(L"scope", L"de", { L"devhome", L"winget-dev" });
+    CHECK((cache.TryGet(L"scope", L"de", true) == Values{ L"devhome", L"winget-dev" }));
+    CHECK((cache.TryGet(L"scope", L"de", false) == Values{ L"devhome", L"winget-dev" }));
+    CHECK(!cache.TryGet(L"other scope", L"de", true));
+}
+
+TEST_CASE(LongerValuesFilterTheLongestPrefix)
+{
+    SearchSuggestionCache cache;
+    cache.Add(L"scope", L"de", { L"devhome", L"DevTools", L"winget-dev", L"debug" });
+    cache.Add(L"scope", L"dev", { L"devhome", L"DevTools", L"winget-dev" });
+
+    // Values containing the typed value are kept, ignoring case.
+    CHECK((cache.TryGet(L"scope", L"devt", true) == Values{ L"DevTools" }));
+    CHECK((cache.TryGet(L"scope", L"DEV", true) == Values{ L"devhome", L"DevTools", L"winget-dev" }));
+    CHECK((cache.TryGet(L"scope", L"deb", true) == Values{ L"debug" }));
+    CHECK(!cache.TryGet(L"scope", L"devt", false));
+    CHECK(!cache.TryGet(L"scope", L"xdev", true));
+}
+
+TEST_CASE(ShortValuesAreNotFiltered)
+{
+    SearchSuggestionCache cache;
+    cache.Add(L"scope", L"", { L"devhome" });
+    cache.Add(L"scope", L"d", { L"devhome" });
+    CHECK(!cache.TryGet(L"scope", L"de", true));
+    CHECK((cache.TryGet(L"scope", L"", true) == Values{ L"devhome" }));
+}
+
+TEST_CASE(OldestAnswersAreDropped)
+{
+    SearchSuggestionCache cache;
+    for (size_t i = 0; i <= SearchSuggestionCache::MaxEntries; i++)
+    {
+        cache.Add(L"scope", L"value" + std::to_wstring(i), { L"suggestion" });
+    }
+
+    CHECK(cache.Count() == SearchSuggestionCache::MaxEntries);
+    CHECK(!cache.TryGet(L"scope", L"value0", false));
+    CHECK(cache.TryGet(L"scope", L"value1", false));
+
+    // Adding the same request again replaces its answer instead of adding another one.
+    cache.Add(L"scope", L"value1", { L"replaced" });
+    CHECK(cache.Count() == SearchSuggestionCache::MaxEntries);
+    CHECK((cache.TryGet(L"scope", L"value1", false) == Values{ L"replaced" }));
+
+    cache.Clear();
+    CHECK(cache.Count() == 0);
+    CHECK(!cache.TryGet(L"scope", L"value1", false));
+}
+
+int main()
+{
+    return PortableTests::RunTests();
+}
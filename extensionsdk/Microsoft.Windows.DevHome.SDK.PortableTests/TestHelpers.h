@@ -0,0 +1,91 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <string>
+#include <vector>
+
+// A minimal test runner, so the portable tests don't need a test framework. A failed check reports its
+// location and fails the current test, and the process exits with a failure code if any test failed.
+namespace PortableTests
+{
+    struct TestCase
+    {
+        char const* name;
+        std::function<void()> body;
+    };
+
+    inline std::vector<TestCase>& GetTestCases()
+    {
+        static std::vector<TestCase> testCases;
+        return testCases;
+    }
+
+    inline int& GetFailureCount()
+    {
+        static int failureCount = 0;
+        return failureCount;
+    }
+
+    struct TestRegistration
+    {
+        TestRegistration(char const* name, std::function<void()> body)
+        {
+            GetTestCases().push_back(TestCase{ name, std::move(body) });
+        }
+    };
+
+    inline void ReportFailure(char const* file, int line, char const* expression)
+    {
+        std::fprintf(stderr, "%s(%d): check failed: %s\n", file, line, expression);
+        GetFailureCount()++;
+    }
+
+    inline int RunTests()
+    {
+        int failedTestCount = 0;
+        for (auto const& testCase : GetTestCases())
+        {
+            auto failureCount = GetFailureCount();
+            testCase.body();
+            auto isPassed = GetFailureCount() == failureCount;
+            std::printf("%s %s\n", isPassed ? "PASSED" : "FAILED", testCase.name);
+            failedTestCount += isPassed ? 0 : 1;
+        }
+
+        std::printf("%d of %zu tests failed\n", failedTestCount, GetTestCases().size());
+        return (failedTestCount == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+}
+
+#define PORTABLE_TEST_CONCAT_INNER(a, b) a##b
+#define PORTABLE_TEST_CONCAT(a, b) PORTABLE_TEST_CONCAT_INNER(a, b)
+
+#define TEST_CASE(name) \
+    static void name(); \
+    static PortableTests::TestRegistration PORTABLE_TEST_CONCAT(name, Registration)(#name, name); \
+    static void name()
+
+#define CHECK(expression) \
+    do \
+    { \
+        if (!(expression)) \
+        { \
+            PortableTests::ReportFailure(__FILE__, __LINE__, #expression); \
+        } \
+    } while (false)
+
+// Stops the current test, for checks that later statements depend on.
+#define REQUIRE(expression) \
+    do \
+    { \
+        if (!(expression)) \
+        { \
+            PortableTests::ReportFailure(__FILE__, __LINE__, #expression); \
+            return; \
+        } \
+    } while (false)
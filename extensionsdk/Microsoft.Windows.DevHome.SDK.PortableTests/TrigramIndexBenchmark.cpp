@@ -0,0 +1,129 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+// Measures the TrigramIndex behind RepositorySearchIndex on synthetic repositories: adding them, a selective
+// query with a typo, a query sharing a prefix with every entry, suggestions for a field, and removing every
+// entry while they share an owner.
+//
+// Usage: TrigramIndexBenchmark [entry count]
+
+#include "pch.h"
+#include "TrigramIndex.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace winrt::Microsoft::Windows::DevHome::SDK::implementation;
+
+namespace
+{
+    constexpr int Iterations = 20;
+    constexpr uint32_t AllFields = TrigramIndex::Field::Name | TrigramIndex::Field::Owner | TrigramIndex::Field::Topics;
+
+    template <typename Function>
+    double MeasureMicroseconds(Function&& function)
+    {
+        auto best = std::chrono::steady_clock::duration::max();
+        for (int i = 0; i < Iterations; i++)
+        {
+            auto start = std::chrono::steady_clock::now();
+            function();
+            best = std::min(best, std::chrono::steady_clock::now() - start);
+        }
+
+        return std::chrono::duration<double, std::micro>(best).count();
+    }
+
+    struct Repository
+    {
+        std::wstring name;
+        std::wstring owner;
+        std::vector<std::wstring> topics;
+    };
+
+    // Names combine a word and a number, owners and topics come from small sets, so that many entries share
+    // trigrams, owners and topics, as they do in real listings.
+    std::vector<Repository> CreateRepositories(uint32_t count, bool hasSharedOwner)
+    {
+        static wchar_t const* const words[] = { L"terminal", L"toolkit", L"service", L"engine", L"sdk", L"docs", L"samples", L"extension" };
+        static wchar_t const* const topics[] = { L"windows", L"cpp", L"csharp", L"cli", L"winui", L"azure", L"docs", L"tools" };
+
+        std::vector<Repository> repositories;
+        repositories.reserve(count);
+        for (uint32_t i = 0; i < count; i++)
+        {
+            Repository repository;
+            repository.name = std::wstring(words[i % 8]) + L"-" + std::to_wstring(i);
+            repository.owner = hasSharedOwner ? L"shared-owner" : L"owner-" + std::to_wstring(i % 1000);
+            repository.topics = { topics[i % 8], topics[(i / 8) % 8] };
+            repositories.push_back(std::move(repository));
+        }
+
+        return repositories;
+    }
+
+    void AddRepositories(TrigramIndex& index, std::vector<Repository> const& repositories, std::vector<uint32_t>& entries)
+    {
+        entries.clear();
+        for (auto const& repository : repositories)
+        {
+            std::vector<std::wstring_view> topics(repository.topics.begin(), repository.topics.end());
+            entries.push_back(index.Add(repository.name, repository.owner, topics));
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    auto entryCount = (argc > 1) ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 100000u;
+
+    auto repositories = CreateRepositories(entryCount, false);
+    std::vector<uint32_t> entries;
+    TrigramIndex index;
+    auto start = std::chrono::steady_clock::now();
+    AddRepositories(index, repositories, entries);
+    auto addTime = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+    // The name of an entry in the middle of the index, with one substituted character.
+    auto typoQuery = repositories[entryCount / 2].name;
+    typoQuery[1] = L'x';
+
+    size_t selectiveMatchCount = 0;
+    auto selectiveTime = MeasureMicroseconds([&]() { selectiveMatchCount = index.Search(typoQuery, AllFields, 20).size(); });
+
+    size_t prefixMatchCount = 0;
+    auto prefixTime = MeasureMicroseconds([&]() { prefixMatchCount = index.Search(L"terminal", AllFields, 20).size(); });
+
+    size_t suggestionCount = 0;
+    auto suggestTime = MeasureMicroseconds([&]() { suggestionCount = index.Suggest(TrigramIndex::Field::Owner, L"owner-42", 10).size(); });
+
+    if (selectiveMatchCount == 0 || prefixMatchCount == 0 || suggestionCount == 0)
+    {
+        std::fprintf(stderr, "A query didn't return the expected entries.\n");
+        return EXIT_FAILURE;
+    }
+
+    TrigramIndex sharedOwnerIndex;
+    AddRepositories(sharedOwnerIndex, CreateRepositories(entryCount, true), entries);
+    start = std::chrono::steady_clock::now();
+    for (auto entry : entries)
+    {
+        sharedOwnerIndex.Remove(entry);
+    }
+
+    auto removeTime = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    if (sharedOwnerIndex.Count() != 0)
+    {
+        std::fprintf(stderr, "The index still has entries after every entry was removed.\n");
+        return EXIT_FAILURE;
+    }
+
+    std::printf("entries:                         %u\n", entryCount);
+    std::printf("add every entry:                 %.1f us\n", addTime);
+    std::printf("selective query with a typo:     %.1f us\n", selectiveTime);
+    std::printf("query sharing a common prefix:   %.1f us\n", prefixTime);
+    std::printf("owner suggestions:               %.1f us\n", suggestTime);
+    std::printf("remove entries sharing an owner: %.1f us\n", removeTime);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,183 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "TestHelpers.h"
+#include "TrigramIndex.h"
+
+#include <thread>
+
+using namespace winrt::Microsoft::Windows::DevHome::SDK::implementation;
+
+namespace
+{
+    constexpr uint32_t AllFields = TrigramIndex::Field::Name | TrigramIndex::Field::Owner | TrigramIndex::Field::Topics;
+
+    std::vector<uint32_t> SearchEntries(TrigramIndex const& index, std::wstring_view query, uint32_t fields = AllFields)
+    {
+        std::vector<uint32_t> entries;
+        for (auto const& match : index.Search(query, fields, 100))
+        {
+            entries.push_back(match.entry);
+        }
+
+        return entries;
+    }
+}
+
+TEST_CASE(SearchIgnoresCase)
+{
+    TrigramIndex index;
+    auto entry = index.Add(L"DevHome", L"Microsoft", { L"Windows" });
+    CHECK((SearchEntries(index, L"devhome") == std::vector<uint32_t>{ entry }));
+    CHECK((SearchEntries(index, L"DEVHOME") == std::vector<uint32_t>{ entry }));
+    CHECK((SearchEntries(index, L"windows") == std::vector<uint32_t>{ entry }));
+}
+
+TEST_CASE(SearchMatchesSingleTypos)
+{
+    TrigramIndex index;
+    auto entry = index.Add(L"terminal-preview", L"owner", {});
+    index.Add(L"calculator", L"owner", {});
+
+    // A substitution, an insertion and a deletion.
+    CHECK((SearchEntries(index, L"terminal-priview", TrigramIndex::Field::Name) == std::vector<uint32_t>{ entry }));
+    CHECK((SearchEntries(index, L"terminal-prevview", TrigramIndex::Field::Name) == std::vector<uint32_t>{ entry }));
+    CHECK((SearchEntries(index, L"terminal-preiew", TrigramIndex::Field::Name) == std::vector<uint32_t>{ entry }));
+    CHECK(SearchEntries(index, L"spreadsheet").empty());
+}
+
+TEST_CASE(SearchRanksMatchesByScore)
+{
+    TrigramIndex index;
+    auto topicMatch = index.Add(L"tools", L"someone", { L"winget" });
+    auto containsMatch = index.Add(L"my-winget", L"someone", {});
+    auto prefixMatch = index.Add(L"winget-cli", L"someone", {});
+
+    // Topics weigh half as much as names, but an exact topic still beats a name that only contains the query.
+    auto matches = index.Search(L"winget", AllFields, 10);
+    REQUIRE(matches.size() == 3);
+    CHECK(matches[0].entry == prefixMatch);
+    CHECK(matches[1].entry == topicMatch);
+    CHECK(matches[2].entry == containsMatch);
+    CHECK(matches[0].score > matches[1].score);
+    CHECK(matches[1].score > matches[2].score);
+
+    CHECK(index.Search(L"winget", AllFields, 1).size() == 1);
+}
+
+TEST_CASE(SearchOnlyMatchesRequestedFields)
+{
+    TrigramIndex index;
+    auto entry = index.Add(L"devhome", L"microsoft", { L"windows" });
+    CHECK(SearchEntries(index, L"microsoft", TrigramIndex::Field::Name).empty());
+    CHECK((SearchEntries(index, L"microsoft", TrigramIndex::Field::Owner) == std::vector<uint32_t>{ entry }));
+    CHECK(SearchEntries(index, L"windows", TrigramIndex::Field::Name | TrigramIndex::Field::Owner).empty());
+    CHECK(SearchEntries(index, L"").empty());
+}
+
+TEST_CASE(RemovedEntriesDontMatchAndAreReused)
+{
+    TrigramIndex index;
+    auto first = index.Add(L"alpha", L"shared-owner", {});
+    auto second = index.Add(L"beta", L"shared-owner", {});
+    auto third = index.Add(L"gamma", L"shared-owner", {});
+    REQUIRE(index.Count() == 3);
+
+    index.Remove(second);
+    index.Remove(second);
+    CHECK(index.Count() == 2);
+    CHECK(SearchEntries(index, L"beta").empty());
+
+    auto ownerMatches = SearchEntries(index, L"shared-owner");
+    std::sort(ownerMatches.begin(), ownerMatches.end());
+    CHECK((ownerMatches == std::vector<uint32_t>{ first, third }));
+
+    CHECK(index.Add(L"delta", L"other-owner", {}) == second);
+    CHECK((SearchEntries(index, L"delta") == std::vector<uint32_t>{ second }));
+}
+
+TEST_CASE(RemovingManyEntriesCompactsThePostings)
+{
+    TrigramIndex index;
+    std::vector<uint32_t> entries;
+    for (int i = 0; i < 3000; i++)
+    {
+        entries.push_back(index.Add(L"repository-" + std::to_wstring(i), L"owner", {}));
+    }
+
+    for (size_t i = 0; i + 1 < entries.size(); i++)
+    {
+        index.Remove(entries[i]);
+    }
+
+    CHECK(index.Count() == 1);
+    CHECK((SearchEntries(index, L"repository-2999") == std::vector<uint32_t>{ entries.back() }));
+    CHECK(SearchEntries(index, L"repository-1234").empty());
+
+    auto added = index.Add(L"repository-1234", L"owner", {});
+    CHECK((SearchEntries(index, L"repository-1234") == std::vector<uint32_t>{ added }));
+}
+
+TEST_CASE(SuggestReturnsTheValuesOfAField)
+{
+    TrigramIndex index;
+    index.Add(L"one", L"contoso", { L"cli", L"cli" });
+    index.Add(L"two", L"contoso", { L"gui" });
+    index.Add(L"three", L"fabrikam", { L"cli" });
+
+    // Without a query, the values used by the most entries come first.
+    CHECK((index.Suggest(TrigramIndex::Field::Owner, L"", 10) == std::vector<std::wstring>{ L"contoso", L"fabrikam" }));
+    CHECK((index.Suggest(TrigramIndex::Field::Topics, L"", 1) == std::vector<std::wstring>{ L"cli" }));
+    CHECK((index.Suggest(TrigramIndex::Field::Owner, L"FABRIKAM", 10) == std::vector<std::wstring>{ L"fabrikam" }));
+}
+
+TEST_CASE(ClearRemovesEveryEntry)
+{
+    TrigramIndex index;
+    index.Add(L"alpha", L"owner", {});
+    index.Search(L"alpha", AllFields, 10);
+    index.Clear();
+    CHECK(index.Count() == 0);
+    CHECK(SearchEntries(index, L"alpha").empty());
+    CHECK(index.Add(L"beta", L"owner", {}) == 0);
+}
+
+TEST_CASE(ConcurrentSearchesReturnTheSameMatches)
+{
+    TrigramIndex index;
+    for (int i = 0; i < 1000; i++)
+    {
+        index.Add(L"repository-" + std::to_wstring(i), L"owner-" + std::to_wstring(i % 10), {});
+    }
+
+    auto expectedMatches = SearchEntries(index, L"repository-42");
+    REQUIRE(!expectedMatches.empty());
+
+    std::vector<int> mismatchCounts(8);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < mismatchCounts.size(); i++)
+    {
+        threads.emplace_back([&index, &expectedMatches, &mismatchCounts, i]() {
+            for (int j = 0; j < 200; j++)
+            {
+                if (SearchEntries(index, L"repository-42") != expectedMatches)
+                {
+                    mismatchCounts[i]++;
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    CHECK(std::all_of(mismatchCounts.begin(), mismatchCounts.end(), [](int count) { return count == 0; }));
+}
+
+int main()
+{
+    return PortableTests::RunTests();
+}
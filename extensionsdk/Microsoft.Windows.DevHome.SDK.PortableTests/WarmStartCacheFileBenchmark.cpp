@@ -0,0 +1,111 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+// Measures what a warm start costs: mapping the cache file, validating it, finding an entry and decoding its
+// records. The writer is measured as well, since the cache is rewritten after every refresh.
+//
+// Usage: WarmStartCacheFileBenchmark [output directory] [items per entry]
+
+#include "pch.h"
+#include "WarmStartCacheFile.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace winrt::Microsoft::Windows::DevHome::SDK::implementation;
+
+namespace
+{
+    constexpr int Iterations = 20;
+
+    template <typename Function>
+    double MeasureMicroseconds(Function&& function)
+    {
+        auto best = std::chrono::steady_clock::duration::max();
+        for (int i = 0; i < Iterations; i++)
+        {
+            auto start = std::chrono::steady_clock::now();
+            function();
+            best = std::min(best, std::chrono::steady_clock::now() - start);
+        }
+
+        return std::chrono::duration<double, std::micro>(best).count();
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    auto outputDirectory = (argc > 1) ? std::filesystem::path{ argv[1] } : std::filesystem::temp_directory_path();
+    auto itemCount = (argc > 2) ? static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10)) : 20000u;
+
+    std::vector<std::u16string> names;
+    for (uint32_t i = 0; i < itemCount; i++)
+    {
+        auto digits = std::to_string(i);
+        names.push_back(u"item-" + std::u16string(digits.begin(), digits.end()));
+    }
+
+    std::vector<WarmStartComputeSystem> computeSystems;
+    std::vector<WarmStartRepository> repositories;
+    for (uint32_t i = 0; i < itemCount; i++)
+    {
+        computeSystems.push_back(WarmStartComputeSystem{ names[i], names[i], u"Hyper-V", 3, 0x1f });
+        repositories.push_back(WarmStartRepository{ names[i], u"owner", names[i], (i % 2) == 0, static_cast<int64_t>(i) });
+    }
+
+    std::vector<uint8_t> bytes;
+    auto serializeTime = MeasureMicroseconds([&]() {
+        WarmStartCacheWriter writer;
+        writer.AddComputeSystems(u"Hyper-V", u"", computeSystems);
+        writer.AddRepositories(u"GitHub", u"developer", repositories);
+        bytes = writer.Serialize();
+    });
+
+    auto path = outputDirectory / "WarmStartCacheFileBenchmark.bin";
+    if (!WriteWarmStartCacheFile(path, bytes))
+    {
+        std::fprintf(stderr, "The cache file couldn't be written.\n");
+        return EXIT_FAILURE;
+    }
+
+    size_t decodedLength = 0;
+    auto loadTime = MeasureMicroseconds([&]() {
+        WarmStartMappedFile file;
+        if (!file.Open(path))
+        {
+            return;
+        }
+
+        auto reader = WarmStartCacheReader::Open(file.Data(), file.Size());
+        auto entry = reader ? reader->Find(WarmStartEntryKind::ComputeSystems, u"Hyper-V", u"") : std::nullopt;
+        if (entry)
+        {
+            decodedLength = 0;
+            for (uint32_t i = 0; i < entry->itemCount; i++)
+            {
+                decodedLength += reader->GetComputeSystem(*entry, i).displayName.size();
+            }
+        }
+    });
+
+    std::filesystem::remove(path);
+
+    size_t expectedLength = 0;
+    for (auto const& name : names)
+    {
+        expectedLength += name.size();
+    }
+
+    if (decodedLength != expectedLength)
+    {
+        std::fprintf(stderr, "The cache file didn't return the written compute systems.\n");
+        return EXIT_FAILURE;
+    }
+
+    std::printf("items per entry:   %u\n", itemCount);
+    std::printf("file size:         %zu bytes\n", bytes.size());
+    std::printf("serialize:         %.1f us\n", serializeTime);
+    std::printf("map, validate and decode one entry: %.1f us\n", loadTime);
+    return EXIT_SUCCESS;
+}
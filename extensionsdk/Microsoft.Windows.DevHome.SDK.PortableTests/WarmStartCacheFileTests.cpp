@@ -0,0 +1,219 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "TestHelpers.h"
+#include "Fnv1aHash.h"
+#include "WarmStartCacheFile.h"
+
+using namespace winrt::Microsoft::Windows::DevHome::SDK::implementation;
+
+namespace
+{
+    std::filesystem::path g_outputDirectory;
+
+    std::vector<uint8_t> SerializeSample()
+    {
+        WarmStartCacheWriter writer;
+        writer.AddComputeSystems(u"Hyper-V", u"", {
+            WarmStartComputeSystem{ u"vm-1", u"Dev box", u"", 3, 0x1f },
+            WarmStartComputeSystem{ u"vm-2", u"Build machine é", u"Hyper-V", 1, 0 },
+        });
+        writer.AddRepositories(u"GitHub", u"developer", {
+            WarmStartRepository{ u"devhome", u"microsoft", u"https://github.com/microsoft/devhome", false, 1700000000 },
+            WarmStartRepository{ u"notes", u"developer", u"https://github.com/developer/notes", true, -1 },
+        });
+        writer.AddRepositories(u"GitHub", u"other", {});
+        return writer.Serialize();
+    }
+
+    void WriteUInt32(std::vector<uint8_t>& bytes, size_t offset, uint32_t value)
+    {
+        for (size_t i = 0; i < sizeof(value); i++)
+        {
+            bytes[offset + i] = static_cast<uint8_t>(value >> (i * 8));
+        }
+    }
+}
+
+TEST_CASE(Fnv1aHashMatchesReferenceValues)
+{
+    Fnv1aHash empty;
+    CHECK(empty.Value() == 0xcbf29ce484222325ull);
+    CHECK(empty.ToHexString() == L"cbf29ce484222325");
+
+    Fnv1aHash text;
+    text.AddBytes(reinterpret_cast<uint8_t const*>("foobar"), 6);
+    CHECK(text.Value() == 0x85944171f73967e8ull);
+
+    // Code units are added in little endian order, whatever the size of wchar_t.
+    Fnv1aHash codeUnits;
+    codeUnits.AddCodeUnits(L"a");
+    Fnv1aHash bytes;
+    bytes.AddByte('a');
+    bytes.AddByte(0);
+    CHECK(codeUnits.Value() == bytes.Value());
+
+    CHECK(Fnv1aHash::ToHexString(0x00000000000000abull) == L"00000000000000ab");
+}
+
+TEST_CASE(Fnv1aHashSeparatesLengthPrefixedStrings)
+{
+    Fnv1aHash first;
+    first.AddString(L"ab");
+    first.AddString(L"c");
+    Fnv1aHash second;
+    second.AddString(L"a");
+    second.AddString(L"bc");
+    CHECK(first.Value() != second.Value());
+}
+
+TEST_CASE(ReaderReturnsWrittenComputeSystems)
+{
+    auto bytes = SerializeSample();
+    auto reader = WarmStartCacheReader::Open(bytes.data(), bytes.size());
+    REQUIRE(reader);
+    CHECK(reader->EntryCount() == 3);
+
+    auto entry = reader->Find(WarmStartEntryKind::ComputeSystems, u"Hyper-V", u"");
+    REQUIRE(entry);
+    REQUIRE(entry->itemCount == 2);
+
+    auto computeSystem = reader->GetComputeSystem(*entry, 1);
+    CHECK(computeSystem.id == u"vm-2");
+    CHECK(computeSystem.displayName == u"Build machine é");
+    CHECK(computeSystem.supplementalDisplayName == u"Hyper-V");
+    CHECK(computeSystem.state == 1);
+    CHECK(computeSystem.supportedOperations == 0);
+    CHECK(reader->GetComputeSystem(*entry, 0).supportedOperations == 0x1f);
+}
+
+TEST_CASE(ReaderReturnsWrittenRepositories)
+{
+    auto bytes = SerializeSample();
+    auto reader = WarmStartCacheReader::Open(bytes.data(), bytes.size());
+    REQUIRE(reader);
+
+    auto entry = reader->Find(WarmStartEntryKind::Repositories, u"GitHub", u"developer");
+    REQUIRE(entry);
+    REQUIRE(entry->itemCount == 2);
+
+    auto repository = reader->GetRepository(*entry, 0);
+    CHECK(repository.displayName == u"devhome");
+    CHECK(repository.owningAccountName == u"microsoft");
+    CHECK(repository.repoUri == u"https://github.com/microsoft/devhome");
+    CHECK(!repository.isPrivate);
+    CHECK(repository.lastUpdated == 1700000000);
+
+    repository = reader->GetRepository(*entry, 1);
+    CHECK(repository.isPrivate);
+    CHECK(repository.lastUpdated == -1);
+
+    auto emptyEntry = reader->Find(WarmStartEntryKind::Repositories, u"GitHub", u"other");
+    REQUIRE(emptyEntry);
+    CHECK(emptyEntry->itemCount == 0);
+}
+
+TEST_CASE(FindMatchesKindAndIds)
+{
+    auto bytes = SerializeSample();
+    auto reader = WarmStartCacheReader::Open(bytes.data(), bytes.size());
+    REQUIRE(reader);
+    CHECK(!reader->Find(WarmStartEntryKind::ComputeSystems, u"GitHub", u"developer"));
+    CHECK(!reader->Find(WarmStartEntryKind::Repositories, u"GitHub", u"Developer"));
+    CHECK(!reader->Find(WarmStartEntryKind::ComputeSystems, u"Hyper-V", u"developer"));
+}
+
+TEST_CASE(WriterStoresRepeatedStringsOnce)
+{
+    WarmStartCacheWriter once;
+    once.AddRepositories(u"GitHub", u"developer", { WarmStartRepository{ u"a", u"owner", u"uri", false, 0 } });
+
+    WarmStartCacheWriter twice;
+    twice.AddRepositories(u"GitHub", u"developer", {
+        WarmStartRepository{ u"a", u"owner", u"uri", false, 0 },
+        WarmStartRepository{ u"a", u"owner", u"uri", false, 0 },
+    });
+
+    auto onceSize = once.Serialize().size();
+    auto twiceSize = twice.Serialize().size();
+    CHECK(twiceSize - onceSize == 4 * sizeof(uint32_t) + sizeof(int64_t));
+}
+
+TEST_CASE(EmptyCacheHasNoEntries)
+{
+    auto bytes = WarmStartCacheWriter{}.Serialize();
+    auto reader = WarmStartCacheReader::Open(bytes.data(), bytes.size());
+    REQUIRE(reader);
+    CHECK(reader->EntryCount() == 0);
+    CHECK(!reader->Find(WarmStartEntryKind::ComputeSystems, u"", u""));
+}
+
+TEST_CASE(OpenRejectsDamagedFiles)
+{
+    auto bytes = SerializeSample();
+
+    CHECK(!WarmStartCacheReader::Open(bytes.data(), 0));
+    CHECK(!WarmStartCacheReader::Open(bytes.data(), 31));
+    CHECK(!WarmStartCacheReader::Open(bytes.data(), bytes.size() - 4));
+
+    // Every byte after the header is covered by the checksum.
+    for (size_t offset = 32; offset < bytes.size(); offset++)
+    {
+        auto damaged = bytes;
+        damaged[offset] ^= 0x40;
+        CHECK(!WarmStartCacheReader::Open(damaged.data(), damaged.size()));
+    }
+
+    auto otherMagic = bytes;
+    otherMagic[0] ^= 1;
+    CHECK(!WarmStartCacheReader::Open(otherMagic.data(), otherMagic.size()));
+
+    auto otherVersion = bytes;
+    WriteUInt32(otherVersion, 4, 2);
+    CHECK(!WarmStartCacheReader::Open(otherVersion.data(), otherVersion.size()));
+
+    auto otherSize = bytes;
+    otherSize.resize(bytes.size() + 4);
+    CHECK(!WarmStartCacheReader::Open(otherSize.data(), otherSize.size()));
+}
+
+TEST_CASE(MappedFileReturnsWrittenBytes)
+{
+    auto bytes = SerializeSample();
+    auto path = g_outputDirectory / "WarmStartCacheFileTests.bin";
+    REQUIRE(WriteWarmStartCacheFile(path, bytes));
+
+    // Writing again replaces the file.
+    REQUIRE(WriteWarmStartCacheFile(path, bytes));
+
+    WarmStartMappedFile file;
+    REQUIRE(file.Open(path));
+    REQUIRE(file.Size() == bytes.size());
+    CHECK(std::equal(bytes.begin(), bytes.end(), file.Data()));
+
+    auto reader = WarmStartCacheReader::Open(file.Data(), file.Size());
+    REQUIRE(reader);
+    CHECK(reader->Find(WarmStartEntryKind::ComputeSystems, u"Hyper-V", u""));
+
+    file.Close();
+    CHECK(file.Data() == nullptr);
+    std::filesystem::remove(path);
+}
+
+TEST_CASE(MappedFileFailsForMissingAndEmptyFiles)
+{
+    WarmStartMappedFile file;
+    CHECK(!file.Open(g_outputDirectory / "WarmStartCacheFileTests.missing"));
+
+    auto emptyPath = g_outputDirectory / "WarmStartCacheFileTests.empty";
+    std::ofstream{ emptyPath, std::ios::binary };
+    CHECK(!file.Open(emptyPath));
+    std::filesystem::remove(emptyPath);
+}
+
+int main(int argc, char* argv[])
+{
+    g_outputDirectory = (argc > 1) ? std::filesystem::path{ argv[1] } : std::filesystem::temp_directory_path();
+    return PortableTests::RunTests();
+}
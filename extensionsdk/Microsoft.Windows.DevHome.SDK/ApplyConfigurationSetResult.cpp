@@ -9,9 +9,44 @@ namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
     {
     }
 
+    ApplyConfigurationSetResult::ApplyConfigurationSetResult(winrt::hresult const& resultCode, DevHomeSDKProjection::ApplyConfigurationUnitResultStream const& unitResultStream) :
+        m_resultCode(resultCode), m_unitResultStream(unitResultStream)
+    {
+        if (!unitResultStream)
+        {
+            throw hresult_invalid_argument(L"unitResultStream parameter should not be null.");
+        }
+    }
+
+    DevHomeSDKProjection::ApplyConfigurationSetResult ApplyConfigurationSetResult::CreateFromStream(winrt::hresult const& resultCode, DevHomeSDKProjection::ApplyConfigurationUnitResultStream const& unitResultStream)
+    {
+        return make<ApplyConfigurationSetResult>(resultCode, unitResultStream);
+    }
+
     IVectorView<DevHomeSDKProjection::ApplyConfigurationUnitResult> ApplyConfigurationSetResult::UnitResults()
     {
-        return m_unitResults;
+        std::lock_guard lock(m_mutex);
+        if (m_unitResults || !m_unitResultStream)
+        {
+            return m_unitResults;
+        }
+
+        // A new reader returns every result appended so far. Once the stream is complete, no result can be
+        // appended, so the results are only copied once.
+        auto isComplete = m_unitResultStream.IsComplete();
+        auto unitResults = m_unitResultStream.CreateReader().ReadAvailable();
+        auto unitResultsView = single_threaded_vector(std::vector<DevHomeSDKProjection::ApplyConfigurationUnitResult>(unitResults.begin(), unitResults.end())).GetView();
+        if (isComplete)
+        {
+            m_unitResults = unitResultsView;
+        }
+
+        return unitResultsView;
+    }
+
+    DevHomeSDKProjection::ApplyConfigurationUnitResultStream ApplyConfigurationSetResult::UnitResultStream()
+    {
+        return m_unitResultStream;
     }
 
     winrt::hresult ApplyConfigurationSetResult::ResultCode()
@@ -10,12 +10,21 @@ namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
     struct ApplyConfigurationSetResult : ApplyConfigurationSetResultT<ApplyConfigurationSetResult>
     {
         ApplyConfigurationSetResult(winrt::hresult const& resultCode, IVectorView<DevHomeSDKProjection::ApplyConfigurationUnitResult> const& unitResults);
+        ApplyConfigurationSetResult(winrt::hresult const& resultCode, DevHomeSDKProjection::ApplyConfigurationUnitResultStream const& unitResultStream);
+
+        static DevHomeSDKProjection::ApplyConfigurationSetResult CreateFromStream(winrt::hresult const& resultCode, DevHomeSDKProjection::ApplyConfigurationUnitResultStream const& unitResultStream);
+
         IVectorView<DevHomeSDKProjection::ApplyConfigurationUnitResult> UnitResults();
+        DevHomeSDKProjection::ApplyConfigurationUnitResultStream UnitResultStream();
         winrt::hresult ResultCode();
 
     private:
+        std::mutex m_mutex;
         winrt::hresult m_resultCode{ S_OK };
+
+        // Set when the result is created from a stream, once the stream is complete.
         IVectorView<DevHomeSDKProjection::ApplyConfigurationUnitResult> m_unitResults{ nullptr };
+        DevHomeSDKProjection::ApplyConfigurationUnitResultStream m_unitResultStream{ nullptr };
     };
 }
 namespace winrt::Microsoft::Windows::DevHome::SDK::factory_implementation
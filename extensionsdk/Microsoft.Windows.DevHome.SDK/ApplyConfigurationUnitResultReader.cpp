@@ -0,0 +1,34 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "ApplyConfigurationUnitResultReader.h"
+#include "ApplyConfigurationUnitResultReader.g.cpp"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    ApplyConfigurationUnitResultReader::ApplyConfigurationUnitResultReader(com_ptr<ApplyConfigurationUnitResultStream> const& stream) :
+        m_stream(stream)
+    {
+    }
+
+    uint32_t ApplyConfigurationUnitResultReader::Position()
+    {
+        std::lock_guard lock(m_mutex);
+        return m_position;
+    }
+
+    bool ApplyConfigurationUnitResultReader::IsAtEnd()
+    {
+        std::lock_guard lock(m_mutex);
+        return m_stream->IsAtEnd(m_position);
+    }
+
+    com_array<ApplyConfigurationUnitResult> ApplyConfigurationUnitResultReader::ReadAvailable()
+    {
+        std::lock_guard lock(m_mutex);
+        auto results = m_stream->GetResults(m_position);
+        m_position += static_cast<uint32_t>(results.size());
+        return com_array<ApplyConfigurationUnitResult>(results.begin(), results.end());
+    }
+}
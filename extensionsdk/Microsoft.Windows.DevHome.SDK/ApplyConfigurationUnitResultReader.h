@@ -0,0 +1,29 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include "ApplyConfigurationUnitResultReader.g.h"
+#include "ApplyConfigurationUnitResultStream.h"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    struct ApplyConfigurationUnitResultReader : ApplyConfigurationUnitResultReaderT<ApplyConfigurationUnitResultReader>
+    {
+        ApplyConfigurationUnitResultReader(com_ptr<ApplyConfigurationUnitResultStream> const& stream);
+
+        uint32_t Position();
+        bool IsAtEnd();
+        com_array<ApplyConfigurationUnitResult> ReadAvailable();
+
+    private:
+        com_ptr<ApplyConfigurationUnitResultStream> m_stream;
+        std::mutex m_mutex;
+        uint32_t m_position{ 0 };
+    };
+}
+namespace winrt::Microsoft::Windows::DevHome::SDK::factory_implementation
+{
+    struct ApplyConfigurationUnitResultReader : ApplyConfigurationUnitResultReaderT<ApplyConfigurationUnitResultReader, implementation::ApplyConfigurationUnitResultReader>
+    {
+    };
+}
@@ -0,0 +1,104 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "ApplyConfigurationUnitResultStream.h"
+#include "ApplyConfigurationUnitResultStream.g.cpp"
+#include "ApplyConfigurationUnitResultReader.h"
+
+namespace Projection = winrt::Microsoft::Windows::DevHome::SDK;
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    uint32_t ApplyConfigurationUnitResultStream::Size()
+    {
+        std::lock_guard lock(m_mutex);
+        return static_cast<uint32_t>(m_results.size());
+    }
+
+    bool ApplyConfigurationUnitResultStream::IsComplete()
+    {
+        std::lock_guard lock(m_mutex);
+        return m_isComplete;
+    }
+
+    void ApplyConfigurationUnitResultStream::Append(ApplyConfigurationUnitResult const& result)
+    {
+        if (!result)
+        {
+            throw hresult_invalid_argument(L"result parameter should not be null.");
+        }
+
+        {
+            std::lock_guard lock(m_mutex);
+            if (m_isComplete)
+            {
+                throw hresult_illegal_method_call(L"Results can't be appended to a complete stream.");
+            }
+
+            m_results.push_back(result);
+        }
+
+        RaiseChanged();
+    }
+
+    void ApplyConfigurationUnitResultStream::Complete()
+    {
+        {
+            std::lock_guard lock(m_mutex);
+            if (m_isComplete)
+            {
+                return;
+            }
+
+            m_isComplete = true;
+        }
+
+        RaiseChanged();
+    }
+
+    Projection::ApplyConfigurationUnitResultReader ApplyConfigurationUnitResultStream::CreateReader()
+    {
+        return make<ApplyConfigurationUnitResultReader>(get_strong());
+    }
+
+    winrt::event_token ApplyConfigurationUnitResultStream::Changed(TypedEventHandler<Projection::ApplyConfigurationUnitResultStream, IInspectable> const& handler)
+    {
+        return m_changed.add(handler);
+    }
+
+    void ApplyConfigurationUnitResultStream::Changed(winrt::event_token const& token) noexcept
+    {
+        m_changed.remove(token);
+    }
+
+    std::vector<ApplyConfigurationUnitResult> ApplyConfigurationUnitResultStream::GetResults(uint32_t position)
+    {
+        std::lock_guard lock(m_mutex);
+        if (position >= m_results.size())
+        {
+            return {};
+        }
+
+        return std::vector<ApplyConfigurationUnitResult>(m_results.begin() + position, m_results.end());
+    }
+
+    bool ApplyConfigurationUnitResultStream::IsAtEnd(uint32_t position)
+    {
+        std::lock_guard lock(m_mutex);
+        return m_isComplete && position >= m_results.size();
+    }
+
+    // Append and Complete are called while a set is applied, so a failing handler must not fail them. The
+    // handlers after a failing one aren't called for that change, but they are for the next one.
+    void ApplyConfigurationUnitResultStream::RaiseChanged()
+    {
+        try
+        {
+            m_changed(*this, nullptr);
+        }
+        catch (...)
+        {
+        }
+    }
+}
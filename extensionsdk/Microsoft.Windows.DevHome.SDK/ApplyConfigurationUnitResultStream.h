@@ -0,0 +1,44 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include "ApplyConfigurationUnitResultStream.g.h"
+
+using namespace winrt::Windows::Foundation;
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    struct ApplyConfigurationUnitResultStream : ApplyConfigurationUnitResultStreamT<ApplyConfigurationUnitResultStream>
+    {
+        ApplyConfigurationUnitResultStream() = default;
+
+        uint32_t Size();
+        bool IsComplete();
+        void Append(ApplyConfigurationUnitResult const& result);
+        void Complete();
+        winrt::Microsoft::Windows::DevHome::SDK::ApplyConfigurationUnitResultReader CreateReader();
+
+        winrt::event_token Changed(TypedEventHandler<winrt::Microsoft::Windows::DevHome::SDK::ApplyConfigurationUnitResultStream, IInspectable> const& handler);
+        void Changed(winrt::event_token const& token) noexcept;
+
+        // Used by ApplyConfigurationUnitResultReader. Returns the results from position on.
+        std::vector<ApplyConfigurationUnitResult> GetResults(uint32_t position);
+        bool IsAtEnd(uint32_t position);
+
+    private:
+        void RaiseChanged();
+
+        std::mutex m_mutex;
+
+        // Results are only appended, so readers only need their position.
+        std::vector<ApplyConfigurationUnitResult> m_results;
+        bool m_isComplete{ false };
+        winrt::event<TypedEventHandler<winrt::Microsoft::Windows::DevHome::SDK::ApplyConfigurationUnitResultStream, IInspectable>> m_changed;
+    };
+}
+namespace winrt::Microsoft::Windows::DevHome::SDK::factory_implementation
+{
+    struct ApplyConfigurationUnitResultStream : ApplyConfigurationUnitResultStreamT<ApplyConfigurationUnitResultStream, implementation::ApplyConfigurationUnitResultStream>
+    {
+    };
+}
@@ -0,0 +1,19 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "ComputeSystemAggregationResult.h"
+#include "ComputeSystemAggregationResult.g.cpp"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    ComputeSystemAggregationResult::ComputeSystemAggregationResult(array_view<winrt::Microsoft::Windows::DevHome::SDK::ComputeSystemProviderQueryResult const> results) :
+        m_results(results.begin(), results.end())
+    {
+    }
+
+    com_array<winrt::Microsoft::Windows::DevHome::SDK::ComputeSystemProviderQueryResult> ComputeSystemAggregationResult::Results()
+    {
+        return com_array<winrt::Microsoft::Windows::DevHome::SDK::ComputeSystemProviderQueryResult>(m_results.begin(), m_results.end());
+    }
+}
@@ -0,0 +1,24 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include "ComputeSystemAggregationResult.g.h"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    struct ComputeSystemAggregationResult : ComputeSystemAggregationResultT<ComputeSystemAggregationResult>
+    {
+        ComputeSystemAggregationResult(array_view<winrt::Microsoft::Windows::DevHome::SDK::ComputeSystemProviderQueryResult const> results);
+
+        com_array<winrt::Microsoft::Windows::DevHome::SDK::ComputeSystemProviderQueryResult> Results();
+
+    private:
+        std::vector<winrt::Microsoft::Windows::DevHome::SDK::ComputeSystemProviderQueryResult> m_results;
+    };
+}
+namespace winrt::Microsoft::Windows::DevHome::SDK::factory_implementation
+{
+    struct ComputeSystemAggregationResult : ComputeSystemAggregationResultT<ComputeSystemAggregationResult, implementation::ComputeSystemAggregationResult>
+    {
+    };
+}
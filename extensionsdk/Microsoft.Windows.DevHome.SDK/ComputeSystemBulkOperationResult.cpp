@@ -0,0 +1,29 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "ComputeSystemBulkOperationResult.h"
+#include "ComputeSystemBulkOperationResult.g.cpp"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    ComputeSystemBulkOperationResult::ComputeSystemBulkOperationResult(array_view<winrt::Microsoft::Windows::DevHome::SDK::ComputeSystemOperationResult const> results) :
+        m_results(results.begin(), results.end()), m_result(ProviderOperationStatus::Success, S_OK, hstring(), hstring())
+    {
+    }
+
+    ComputeSystemBulkOperationResult::ComputeSystemBulkOperationResult(winrt::hresult const& e, hstring const& displayMessage, hstring const& diagnosticText) :
+        m_results(), m_result(ProviderOperationStatus::Failure, e, displayMessage, diagnosticText)
+    {
+    }
+
+    com_array<winrt::Microsoft::Windows::DevHome::SDK::ComputeSystemOperationResult> ComputeSystemBulkOperationResult::Results()
+    {
+        return com_array<winrt::Microsoft::Windows::DevHome::SDK::ComputeSystemOperationResult>(m_results.begin(), m_results.end());
+    }
+
+    ProviderOperationResult ComputeSystemBulkOperationResult::Result()
+    {
+        return m_result;
+    }
+}
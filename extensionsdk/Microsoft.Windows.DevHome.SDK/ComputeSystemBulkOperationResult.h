@@ -0,0 +1,27 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include "ComputeSystemBulkOperationResult.g.h"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    struct ComputeSystemBulkOperationResult : ComputeSystemBulkOperationResultT<ComputeSystemBulkOperationResult>
+    {
+        ComputeSystemBulkOperationResult(array_view<winrt::Microsoft::Windows::DevHome::SDK::ComputeSystemOperationResult const> results);
+        ComputeSystemBulkOperationResult(winrt::hresult const& e, hstring const& displayMessage, hstring const& diagnosticText);
+        com_array<winrt::Microsoft::Windows::DevHome::SDK::ComputeSystemOperationResult> Results();
+        ProviderOperationResult Result();
+
+    private:
+        std::vector<winrt::Microsoft::Windows::DevHome::SDK::ComputeSystemOperationResult> m_results;
+        ProviderOperationResult m_result;
+    };
+}
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::factory_implementation
+{
+    struct ComputeSystemBulkOperationResult : ComputeSystemBulkOperationResultT<ComputeSystemBulkOperationResult, implementation::ComputeSystemBulkOperationResult>
+    {
+    };
+}
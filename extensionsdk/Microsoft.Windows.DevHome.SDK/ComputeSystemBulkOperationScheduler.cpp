@@ -0,0 +1,239 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "ComputeSystemBulkOperationScheduler.h"
+#include "ComputeSystemBulkOperationScheduler.g.cpp"
+#include "ComputeSystemBulkOperationResult.h"
+#include "OperationTracker.h"
+
+namespace Projection = winrt::Microsoft::Windows::DevHome::SDK;
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    namespace
+    {
+        using StartOperationFunction = IAsyncOperation<Projection::ComputeSystemOperationResult> (*)(IComputeSystem const&, hstring const&);
+
+        // Shared between the bulk operation and the completion handlers of the operations.
+        struct BulkOperationState
+        {
+            explicit BulkOperationState(uint32_t computeSystemCount) :
+                operations(computeSystemCount), results(computeSystemCount, nullptr)
+            {
+            }
+
+            OperationTracker operations;
+            std::mutex mutex;
+            std::vector<Projection::ComputeSystemOperationResult> results;
+            std::vector<uint32_t> completedComputeSystems;
+            uint32_t activeOperationCount{ 0 };
+            uint32_t completedOperationCount{ 0 };
+        };
+
+        StartOperationFunction GetStartOperationFunction(ComputeSystemOperations operation)
+        {
+            switch (operation)
+            {
+            case ComputeSystemOperations::Start:
+                return [](IComputeSystem const& computeSystem, hstring const& options) { return computeSystem.StartAsync(options); };
+            case ComputeSystemOperations::ShutDown:
+                return [](IComputeSystem const& computeSystem, hstring const& options) { return computeSystem.ShutDownAsync(options); };
+            case ComputeSystemOperations::Terminate:
+                return [](IComputeSystem const& computeSystem, hstring const& options) { return computeSystem.TerminateAsync(options); };
+            case ComputeSystemOperations::Delete:
+                return [](IComputeSystem const& computeSystem, hstring const& options) { return computeSystem.DeleteAsync(options); };
+            case ComputeSystemOperations::Save:
+                return [](IComputeSystem const& computeSystem, hstring const& options) { return computeSystem.SaveAsync(options); };
+            case ComputeSystemOperations::Pause:
+                return [](IComputeSystem const& computeSystem, hstring const& options) { return computeSystem.PauseAsync(options); };
+            case ComputeSystemOperations::Resume:
+                return [](IComputeSystem const& computeSystem, hstring const& options) { return computeSystem.ResumeAsync(options); };
+            case ComputeSystemOperations::Restart:
+                return [](IComputeSystem const& computeSystem, hstring const& options) { return computeSystem.RestartAsync(options); };
+            case ComputeSystemOperations::CreateSnapshot:
+                return [](IComputeSystem const& computeSystem, hstring const& options) { return computeSystem.CreateSnapshotAsync(options); };
+            case ComputeSystemOperations::RevertSnapshot:
+                return [](IComputeSystem const& computeSystem, hstring const& options) { return computeSystem.RevertSnapshotAsync(options); };
+            case ComputeSystemOperations::DeleteSnapshot:
+                return [](IComputeSystem const& computeSystem, hstring const& options) { return computeSystem.DeleteSnapshotAsync(options); };
+            case ComputeSystemOperations::ModifyProperties:
+                return [](IComputeSystem const& computeSystem, hstring const& options) { return computeSystem.ModifyPropertiesAsync(options); };
+            default:
+                return nullptr;
+            }
+        }
+
+        Projection::ComputeSystemOperationResult CreateFailureResult(winrt::hresult const& e, hstring const& diagnosticText)
+        {
+            return Projection::ComputeSystemOperationResult(e, diagnosticText, diagnosticText);
+        }
+
+        Projection::ComputeSystemOperationResult GetOperationResult(IAsyncOperation<Projection::ComputeSystemOperationResult> const& operation, AsyncStatus status)
+        {
+            try
+            {
+                if (status == AsyncStatus::Canceled)
+                {
+                    return CreateFailureResult(HRESULT_FROM_WIN32(ERROR_CANCELLED), L"The operation was cancelled.");
+                }
+
+                return operation.GetResults();
+            }
+            catch (hresult_error const& error)
+            {
+                return CreateFailureResult(error.code(), error.message());
+            }
+        }
+
+        void CompleteOperation(std::shared_ptr<BulkOperationState> const& state, uint32_t computeSystemIndex, Projection::ComputeSystemOperationResult const& result)
+        {
+            {
+                std::lock_guard lock(state->mutex);
+                if (state->results[computeSystemIndex])
+                {
+                    return;
+                }
+
+                state->results[computeSystemIndex] = result;
+                state->activeOperationCount--;
+                state->completedOperationCount++;
+                state->completedComputeSystems.push_back(computeSystemIndex);
+            }
+
+            state->operations.Complete(computeSystemIndex);
+        }
+
+        void StartOperation(
+            std::shared_ptr<BulkOperationState> const& state,
+            IComputeSystem const& computeSystem,
+            uint32_t computeSystemIndex,
+            StartOperationFunction startOperation,
+            hstring const& options)
+        {
+            try
+            {
+                if (!computeSystem)
+                {
+                    throw hresult_invalid_argument(L"The compute system is null.");
+                }
+
+                auto operation = startOperation(computeSystem, options);
+                state->operations.Track(computeSystemIndex, operation);
+                operation.Completed([state, computeSystemIndex](auto const& sender, AsyncStatus status) {
+                    CompleteOperation(state, computeSystemIndex, GetOperationResult(sender, status));
+                });
+            }
+            catch (hresult_error const& error)
+            {
+                CompleteOperation(state, computeSystemIndex, CreateFailureResult(error.code(), error.message()));
+            }
+        }
+    }
+
+    ComputeSystemBulkOperationScheduler::ComputeSystemBulkOperationScheduler(uint32_t maxConcurrentOperations, TimeSpan const& startInterval) :
+        m_maxConcurrentOperations(maxConcurrentOperations), m_startInterval(startInterval)
+    {
+        if (maxConcurrentOperations == 0)
+        {
+            throw hresult_invalid_argument(L"maxConcurrentOperations parameter should be at least 1.");
+        }
+
+        if (startInterval < TimeSpan::zero())
+        {
+            throw hresult_invalid_argument(L"startInterval parameter should not be negative.");
+        }
+    }
+
+    uint32_t ComputeSystemBulkOperationScheduler::MaxConcurrentOperations()
+    {
+        return m_maxConcurrentOperations;
+    }
+
+    TimeSpan ComputeSystemBulkOperationScheduler::StartInterval()
+    {
+        return m_startInterval;
+    }
+
+    IAsyncOperationWithProgress<Projection::ComputeSystemBulkOperationResult, ComputeSystemBulkOperationProgress> ComputeSystemBulkOperationScheduler::PerformOperationAsync(
+        array_view<IComputeSystem const> computeSystems,
+        ComputeSystemOperations operation,
+        hstring options)
+    {
+        // The array_view refers to the caller's memory, so it has to be copied before the first suspension.
+        std::vector<IComputeSystem> computeSystemList{ computeSystems.begin(), computeSystems.end() };
+        auto strongThis = get_strong();
+        auto cancellation = co_await get_cancellation_token();
+        auto progress = co_await get_progress_token();
+
+        auto startOperation = GetStartOperationFunction(operation);
+        if (!startOperation)
+        {
+            throw hresult_invalid_argument(L"operation parameter should be a single operation that IComputeSystem performs with an options string.");
+        }
+
+        auto totalCount = static_cast<uint32_t>(computeSystemList.size());
+        auto state = std::make_shared<BulkOperationState>(totalCount);
+
+        cancellation.callback([state]() {
+            state->operations.CancelAll();
+        });
+
+        uint32_t nextComputeSystem = 0;
+        auto nextStartTime = winrt::clock::now();
+        while (true)
+        {
+            std::vector<uint32_t> computeSystemsToStart;
+            std::vector<ComputeSystemBulkOperationProgress> progressToReport;
+            TimeSpan waitTime{};
+            bool isCompleted;
+            auto now = winrt::clock::now();
+            auto isCanceled = state->operations.IsCanceled();
+            {
+                std::lock_guard lock(state->mutex);
+                for (auto computeSystemIndex : state->completedComputeSystems)
+                {
+                    progressToReport.push_back(ComputeSystemBulkOperationProgress{ computeSystemIndex, true, state->completedOperationCount, totalCount });
+                }
+
+                state->completedComputeSystems.clear();
+                while (!isCanceled && nextComputeSystem < totalCount && state->activeOperationCount < m_maxConcurrentOperations && now >= nextStartTime)
+                {
+                    computeSystemsToStart.push_back(nextComputeSystem++);
+                    state->activeOperationCount++;
+                    nextStartTime = now + m_startInterval;
+                    progressToReport.push_back(ComputeSystemBulkOperationProgress{ computeSystemsToStart.back(), false, state->completedOperationCount, totalCount });
+                }
+
+                // Wake up when the next operation is allowed to start, unless it is waiting for a running one.
+                if (!isCanceled && nextComputeSystem < totalCount && state->activeOperationCount < m_maxConcurrentOperations)
+                {
+                    waitTime = nextStartTime - now;
+                }
+
+                isCompleted = state->completedOperationCount == totalCount;
+            }
+
+            for (auto const& operationProgress : progressToReport)
+            {
+                progress(operationProgress);
+            }
+
+            // Operations are started outside of the lock because an operation can complete synchronously.
+            for (auto computeSystemIndex : computeSystemsToStart)
+            {
+                StartOperation(state, computeSystemList[computeSystemIndex], computeSystemIndex, startOperation, options);
+            }
+
+            if (isCompleted)
+            {
+                break;
+            }
+
+            // Throws when the bulk operation is cancelled. A zero timeout waits until the event is signaled.
+            co_await state->operations.WaitForChange(waitTime);
+        }
+
+        co_return make<ComputeSystemBulkOperationResult>(state->results);
+    }
+}
@@ -0,0 +1,32 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include "ComputeSystemBulkOperationScheduler.g.h"
+
+using namespace winrt::Windows::Foundation;
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    struct ComputeSystemBulkOperationScheduler : ComputeSystemBulkOperationSchedulerT<ComputeSystemBulkOperationScheduler>
+    {
+        ComputeSystemBulkOperationScheduler(uint32_t maxConcurrentOperations, TimeSpan const& startInterval);
+
+        uint32_t MaxConcurrentOperations();
+        TimeSpan StartInterval();
+        IAsyncOperationWithProgress<winrt::Microsoft::Windows::DevHome::SDK::ComputeSystemBulkOperationResult, ComputeSystemBulkOperationProgress> PerformOperationAsync(
+            array_view<IComputeSystem const> computeSystems,
+            ComputeSystemOperations operation,
+            hstring options);
+
+    private:
+        uint32_t m_maxConcurrentOperations;
+        TimeSpan m_startInterval;
+    };
+}
+namespace winrt::Microsoft::Windows::DevHome::SDK::factory_implementation
+{
+    struct ComputeSystemBulkOperationScheduler : ComputeSystemBulkOperationSchedulerT<ComputeSystemBulkOperationScheduler, implementation::ComputeSystemBulkOperationScheduler>
+    {
+    };
+}
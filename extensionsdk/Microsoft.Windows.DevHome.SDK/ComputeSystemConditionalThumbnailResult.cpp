@@ -0,0 +1,87 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "ComputeSystemConditionalThumbnailResult.h"
+#include "ComputeSystemConditionalThumbnailResult.g.cpp"
+#include "Fnv1aHash.h"
+
+using namespace winrt::Windows::Storage::Streams;
+
+namespace
+{
+    IBuffer EmptyBuffer()
+    {
+        const uint32_t capacity = 0;
+        return Buffer{ capacity };
+    }
+}
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    ComputeSystemConditionalThumbnailResult::ComputeSystemConditionalThumbnailResult(IBuffer const& thumbnail, hstring const& contentHash) :
+        m_status(ComputeSystemThumbnailStatus::Modified),
+        m_thumbnail(thumbnail ? thumbnail : EmptyBuffer()),
+        m_contentHash(contentHash.empty() ? ComputeContentHash(m_thumbnail) : contentHash),
+        m_result(ProviderOperationStatus::Success, S_OK, hstring(), hstring())
+    {
+    }
+
+    ComputeSystemConditionalThumbnailResult::ComputeSystemConditionalThumbnailResult(winrt::hresult const& e, hstring const& displayMessage, hstring const& diagnosticText) :
+        m_status(ComputeSystemThumbnailStatus::Modified), m_thumbnail(EmptyBuffer()), m_result(ProviderOperationStatus::Failure, e, displayMessage, diagnosticText)
+    {
+    }
+
+    ComputeSystemConditionalThumbnailResult::ComputeSystemConditionalThumbnailResult(hstring const& contentHash) :
+        m_status(ComputeSystemThumbnailStatus::NotModified), m_thumbnail(EmptyBuffer()), m_contentHash(contentHash), m_result(ProviderOperationStatus::Success, S_OK, hstring(), hstring())
+    {
+    }
+
+    winrt::Microsoft::Windows::DevHome::SDK::ComputeSystemConditionalThumbnailResult ComputeSystemConditionalThumbnailResult::CreateNotModified(hstring const& contentHash)
+    {
+        return make<ComputeSystemConditionalThumbnailResult>(contentHash);
+    }
+
+    winrt::Microsoft::Windows::DevHome::SDK::ComputeSystemConditionalThumbnailResult ComputeSystemConditionalThumbnailResult::CreateIfModified(IBuffer const& thumbnail, hstring const& lastContentHash)
+    {
+        auto contentHash = ComputeContentHash(thumbnail);
+        if (!lastContentHash.empty() && contentHash == lastContentHash)
+        {
+            return make<ComputeSystemConditionalThumbnailResult>(contentHash);
+        }
+
+        return make<ComputeSystemConditionalThumbnailResult>(thumbnail, contentHash);
+    }
+
+    ComputeSystemThumbnailStatus ComputeSystemConditionalThumbnailResult::Status()
+    {
+        return m_status;
+    }
+
+    IBuffer ComputeSystemConditionalThumbnailResult::Thumbnail()
+    {
+        return m_thumbnail;
+    }
+
+    hstring ComputeSystemConditionalThumbnailResult::ContentHash()
+    {
+        return m_contentHash;
+    }
+
+    ProviderOperationResult ComputeSystemConditionalThumbnailResult::Result()
+    {
+        return m_result;
+    }
+
+    // The hash only has to tell images of the same compute system apart, so a cryptographic hash isn't needed.
+    hstring ComputeSystemConditionalThumbnailResult::ComputeContentHash(IBuffer const& thumbnail)
+    {
+        Fnv1aHash hash;
+        if (thumbnail)
+        {
+            hash.AddBytes(thumbnail.data(), thumbnail.Length());
+        }
+
+        return hstring{ hash.ToHexString() };
+    }
+}
@@ -0,0 +1,39 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include "ComputeSystemConditionalThumbnailResult.g.h"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    struct ComputeSystemConditionalThumbnailResult : ComputeSystemConditionalThumbnailResultT<ComputeSystemConditionalThumbnailResult>
+    {
+        ComputeSystemConditionalThumbnailResult(winrt::Windows::Storage::Streams::IBuffer const& thumbnail, hstring const& contentHash);
+        ComputeSystemConditionalThumbnailResult(winrt::hresult const& e, hstring const& displayMessage, hstring const& diagnosticText);
+
+        static winrt::Microsoft::Windows::DevHome::SDK::ComputeSystemConditionalThumbnailResult CreateNotModified(hstring const& contentHash);
+        static winrt::Microsoft::Windows::DevHome::SDK::ComputeSystemConditionalThumbnailResult CreateIfModified(winrt::Windows::Storage::Streams::IBuffer const& thumbnail, hstring const& lastContentHash);
+
+        ComputeSystemThumbnailStatus Status();
+        winrt::Windows::Storage::Streams::IBuffer Thumbnail();
+        hstring ContentHash();
+        ProviderOperationResult Result();
+
+    private:
+        ComputeSystemConditionalThumbnailResult(hstring const& contentHash);
+
+        static hstring ComputeContentHash(winrt::Windows::Storage::Streams::IBuffer const& thumbnail);
+
+        ComputeSystemThumbnailStatus m_status;
+        winrt::Windows::Storage::Streams::IBuffer m_thumbnail;
+        hstring m_contentHash;
+        ProviderOperationResult m_result;
+    };
+}
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::factory_implementation
+{
+    struct ComputeSystemConditionalThumbnailResult : ComputeSystemConditionalThumbnailResultT<ComputeSystemConditionalThumbnailResult, implementation::ComputeSystemConditionalThumbnailResult>
+    {
+    };
+}
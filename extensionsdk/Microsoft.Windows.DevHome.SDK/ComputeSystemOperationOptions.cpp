@@ -0,0 +1,344 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "ComputeSystemOperationOptions.h"
+#include "ComputeSystemOperationOptions.g.cpp"
+
+using namespace winrt::Windows::Data::Json;
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    namespace
+    {
+        auto FindOption(std::vector<std::pair<hstring, ComputeSystemOperationOptions::OptionValue>>& options, hstring const& key)
+        {
+            return std::lower_bound(options.begin(), options.end(), key, [](auto const& option, hstring const& value) {
+                return option.first < value;
+            });
+        }
+
+        [[noreturn]] void ThrowTypeMismatch(hstring const& key)
+        {
+            throw hresult_illegal_method_call(L"The value of option '" + key + L"' has a different type.");
+        }
+
+        // 2^63 is exactly representable, unlike the largest Int64 value, which rounds up to it. NaN fails both
+        // comparisons.
+        bool IsInt64(double value)
+        {
+            constexpr double int64Limit = 9223372036854775808.0;
+            return value >= -int64Limit && value < int64Limit && std::trunc(value) == value;
+        }
+    }
+
+    winrt::Microsoft::Windows::DevHome::SDK::ComputeSystemOperationOptions ComputeSystemOperationOptions::ParseJson(hstring const& json)
+    {
+        auto options = make_self<ComputeSystemOperationOptions>();
+        if (json.empty())
+        {
+            return *options;
+        }
+
+        for (auto const& [key, value] : JsonObject::Parse(json))
+        {
+            switch (value.ValueType())
+            {
+            case JsonValueType::String:
+                options->Set(key, value.GetString());
+                break;
+            case JsonValueType::Number:
+                options->Set(key, value.GetNumber());
+                break;
+            case JsonValueType::Boolean:
+                options->Set(key, value.GetBoolean());
+                break;
+            case JsonValueType::Null:
+                break;
+            default:
+                options->Set(key, value.Stringify());
+                break;
+            }
+        }
+
+        return *options;
+    }
+
+    winrt::Microsoft::Windows::DevHome::SDK::ComputeSystemOperationOptions ComputeSystemOperationOptions::FromOptions(array_view<ComputeSystemOperationOption const> options)
+    {
+        auto result = make_self<ComputeSystemOperationOptions>();
+        for (auto const& option : options)
+        {
+            switch (option.Type)
+            {
+            case ComputeSystemOperationOptionType::String:
+                result->Set(option.Key, option.StringValue);
+                break;
+            case ComputeSystemOperationOptionType::Int64:
+                result->Set(option.Key, option.Int64Value);
+                break;
+            case ComputeSystemOperationOptionType::Double:
+                result->Set(option.Key, option.DoubleValue);
+                break;
+            case ComputeSystemOperationOptionType::Boolean:
+                result->Set(option.Key, option.BooleanValue);
+                break;
+            default:
+                throw hresult_invalid_argument(L"options parameter should only contain options with a known type.");
+            }
+        }
+
+        return *result;
+    }
+
+    // Every operation IComputeSystem performs with an options string, each of them a single flag.
+    bool ComputeSystemOperationOptions::IsSupportedOperation(ComputeSystemOperations const& operation)
+    {
+        switch (operation)
+        {
+        case ComputeSystemOperations::Start:
+        case ComputeSystemOperations::ShutDown:
+        case ComputeSystemOperations::Terminate:
+        case ComputeSystemOperations::Delete:
+        case ComputeSystemOperations::Save:
+        case ComputeSystemOperations::Pause:
+        case ComputeSystemOperations::Resume:
+        case ComputeSystemOperations::Restart:
+        case ComputeSystemOperations::CreateSnapshot:
+        case ComputeSystemOperations::RevertSnapshot:
+        case ComputeSystemOperations::DeleteSnapshot:
+        case ComputeSystemOperations::ModifyProperties:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    uint32_t ComputeSystemOperationOptions::Size()
+    {
+        std::shared_lock lock(m_mutex);
+        return static_cast<uint32_t>(m_options.size());
+    }
+
+    bool ComputeSystemOperationOptions::HasKey(hstring const& key)
+    {
+        std::shared_lock lock(m_mutex);
+        auto it = FindOption(m_options, key);
+        return it != m_options.end() && it->first == key;
+    }
+
+    bool ComputeSystemOperationOptions::Remove(hstring const& key)
+    {
+        std::unique_lock lock(m_mutex);
+        auto it = FindOption(m_options, key);
+        if (it == m_options.end() || it->first != key)
+        {
+            return false;
+        }
+
+        m_options.erase(it);
+        return true;
+    }
+
+    void ComputeSystemOperationOptions::SetString(hstring const& key, hstring const& value)
+    {
+        Set(key, value);
+    }
+
+    void ComputeSystemOperationOptions::SetInt64(hstring const& key, int64_t value)
+    {
+        Set(key, value);
+    }
+
+    void ComputeSystemOperationOptions::SetDouble(hstring const& key, double value)
+    {
+        Set(key, value);
+    }
+
+    void ComputeSystemOperationOptions::SetBoolean(hstring const& key, bool value)
+    {
+        Set(key, value);
+    }
+
+    hstring ComputeSystemOperationOptions::GetString(hstring const& key, hstring const& defaultValue)
+    {
+        auto value = Find(key);
+        if (!value)
+        {
+            return defaultValue;
+        }
+
+        if (auto stringValue = std::get_if<hstring>(&*value))
+        {
+            return *stringValue;
+        }
+
+        ThrowTypeMismatch(key);
+    }
+
+    int64_t ComputeSystemOperationOptions::GetInt64(hstring const& key, int64_t defaultValue)
+    {
+        auto value = Find(key);
+        if (!value)
+        {
+            return defaultValue;
+        }
+
+        if (auto intValue = std::get_if<int64_t>(&*value))
+        {
+            return *intValue;
+        }
+
+        // JSON numbers are parsed as Double. Converting a Double outside of the range of Int64 is undefined, and
+        // truncating a fraction would silently change the value.
+        if (auto doubleValue = std::get_if<double>(&*value))
+        {
+            if (!IsInt64(*doubleValue))
+            {
+                throw hresult_illegal_method_call(L"The value of option '" + key + L"' isn't a whole number in the range of Int64.");
+            }
+
+            return static_cast<int64_t>(*doubleValue);
+        }
+
+        ThrowTypeMismatch(key);
+    }
+
+    double ComputeSystemOperationOptions::GetDouble(hstring const& key, double defaultValue)
+    {
+        auto value = Find(key);
+        if (!value)
+        {
+            return defaultValue;
+        }
+
+        if (auto doubleValue = std::get_if<double>(&*value))
+        {
+            return *doubleValue;
+        }
+
+        if (auto intValue = std::get_if<int64_t>(&*value))
+        {
+            return static_cast<double>(*intValue);
+        }
+
+        ThrowTypeMismatch(key);
+    }
+
+    bool ComputeSystemOperationOptions::GetBoolean(hstring const& key, bool defaultValue)
+    {
+        auto value = Find(key);
+        if (!value)
+        {
+            return defaultValue;
+        }
+
+        if (auto boolValue = std::get_if<bool>(&*value))
+        {
+            return *boolValue;
+        }
+
+        ThrowTypeMismatch(key);
+    }
+
+    hstring ComputeSystemOperationOptions::ToJson()
+    {
+        JsonObject json;
+        std::shared_lock lock(m_mutex);
+        for (auto const& [key, value] : m_options)
+        {
+            json.Insert(key, std::visit([&key](auto const& optionValue) -> IJsonValue {
+                using T = std::decay_t<decltype(optionValue)>;
+                if constexpr (std::is_same_v<T, hstring>)
+                {
+                    return JsonValue::CreateStringValue(optionValue);
+                }
+                else if constexpr (std::is_same_v<T, bool>)
+                {
+                    return JsonValue::CreateBooleanValue(optionValue);
+                }
+                else if constexpr (std::is_same_v<T, int64_t>)
+                {
+                    // JSON numbers are Double, which can't hold every Int64 value. Rounding would silently
+                    // change the value, for instance an identifier or a size in bytes.
+                    auto number = static_cast<double>(optionValue);
+                    if (!IsInt64(number) || static_cast<int64_t>(number) != optionValue)
+                    {
+                        throw hresult_illegal_method_call(L"The value of option '" + key + L"' can't be represented exactly by a JSON number.");
+                    }
+
+                    return JsonValue::CreateNumberValue(number);
+                }
+                else
+                {
+                    return JsonValue::CreateNumberValue(optionValue);
+                }
+            }, value));
+        }
+
+        return json.Stringify();
+    }
+
+    com_array<ComputeSystemOperationOption> ComputeSystemOperationOptions::ToOptions()
+    {
+        std::shared_lock lock(m_mutex);
+        com_array<ComputeSystemOperationOption> options(static_cast<uint32_t>(m_options.size()));
+        for (size_t i = 0; i < m_options.size(); i++)
+        {
+            auto const& [key, value] = m_options[i];
+            auto& option = options[static_cast<uint32_t>(i)];
+            option.Key = key;
+            std::visit([&option](auto const& optionValue) {
+                using T = std::decay_t<decltype(optionValue)>;
+                if constexpr (std::is_same_v<T, hstring>)
+                {
+                    option.Type = ComputeSystemOperationOptionType::String;
+                    option.StringValue = optionValue;
+                }
+                else if constexpr (std::is_same_v<T, int64_t>)
+                {
+                    option.Type = ComputeSystemOperationOptionType::Int64;
+                    option.Int64Value = optionValue;
+                }
+                else if constexpr (std::is_same_v<T, double>)
+                {
+                    option.Type = ComputeSystemOperationOptionType::Double;
+                    option.DoubleValue = optionValue;
+                }
+                else
+                {
+                    option.Type = ComputeSystemOperationOptionType::Boolean;
+                    option.BooleanValue = optionValue;
+                }
+            }, value);
+        }
+
+        return options;
+    }
+
+    void ComputeSystemOperationOptions::Set(hstring const& key, OptionValue&& value)
+    {
+        std::unique_lock lock(m_mutex);
+        auto it = FindOption(m_options, key);
+        if (it != m_options.end() && it->first == key)
+        {
+            it->second = std::move(value);
+        }
+        else
+        {
+            m_options.emplace(it, key, std::move(value));
+        }
+    }
+
+    std::optional<ComputeSystemOperationOptions::OptionValue> ComputeSystemOperationOptions::Find(hstring const& key)
+    {
+        std::shared_lock lock(m_mutex);
+        auto it = FindOption(m_options, key);
+        if (it == m_options.end() || it->first != key)
+        {
+            return std::nullopt;
+        }
+
+        return it->second;
+    }
+}
@@ -0,0 +1,51 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include "ComputeSystemOperationOptions.g.h"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    struct ComputeSystemOperationOptions : ComputeSystemOperationOptionsT<ComputeSystemOperationOptions>
+    {
+        using OptionValue = std::variant<hstring, int64_t, double, bool>;
+
+        ComputeSystemOperationOptions() = default;
+
+        static winrt::Microsoft::Windows::DevHome::SDK::ComputeSystemOperationOptions ParseJson(hstring const& json);
+        static winrt::Microsoft::Windows::DevHome::SDK::ComputeSystemOperationOptions FromOptions(array_view<ComputeSystemOperationOption const> options);
+        static bool IsSupportedOperation(ComputeSystemOperations const& operation);
+
+        uint32_t Size();
+        bool HasKey(hstring const& key);
+        bool Remove(hstring const& key);
+        void SetString(hstring const& key, hstring const& value);
+        void SetInt64(hstring const& key, int64_t value);
+        void SetDouble(hstring const& key, double value);
+        void SetBoolean(hstring const& key, bool value);
+        hstring GetString(hstring const& key, hstring const& defaultValue);
+        int64_t GetInt64(hstring const& key, int64_t defaultValue);
+        double GetDouble(hstring const& key, double defaultValue);
+        bool GetBoolean(hstring const& key, bool defaultValue);
+        hstring ToJson();
+        com_array<ComputeSystemOperationOption> ToOptions();
+
+    private:
+        void Set(hstring const& key, OptionValue&& value);
+
+        // Returns a copy of the value, or nullopt when the key doesn't exist.
+        std::optional<OptionValue> Find(hstring const& key);
+
+        std::shared_mutex m_mutex;
+
+        // Sorted by key. Options have a handful of entries, so a sorted vector is smaller and faster to search
+        // than a map.
+        std::vector<std::pair<hstring, OptionValue>> m_options;
+    };
+}
+namespace winrt::Microsoft::Windows::DevHome::SDK::factory_implementation
+{
+    struct ComputeSystemOperationOptions : ComputeSystemOperationOptionsT<ComputeSystemOperationOptions, implementation::ComputeSystemOperationOptions>
+    {
+    };
+}
@@ -17,13 +17,23 @@ namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
     {
     }
 
-    Projection::ComputeSystemProperty ComputeSystemProperty::Create(Projection::ComputeSystemPropertyKind const& propertyKind, IInspectable const& propertyValue)
+    // Create a predefined compute system property whose value is stored without boxing it.
+    ComputeSystemProperty::ComputeSystemProperty(Projection::ComputeSystemPropertyKind const& propertyKind, PropertyValue&& propertyValue) :
+        m_propertyKind(propertyKind), m_value(std::move(propertyValue)), m_icon(nullptr), m_name(L"")
+    {
+    }
+
+    void ComputeSystemProperty::ThrowIfCustom(Projection::ComputeSystemPropertyKind const& propertyKind)
     {
         if (propertyKind == Projection::ComputeSystemPropertyKind::Custom)
         {
             throw hresult_invalid_argument(L"propertyKind parameter should not be 'Custom'. Use CreateCustom method instead.");
         }
+    }
 
+    Projection::ComputeSystemProperty ComputeSystemProperty::Create(Projection::ComputeSystemPropertyKind const& propertyKind, IInspectable const& propertyValue)
+    {
+        ThrowIfCustom(propertyKind);
         return make<ComputeSystemProperty>(propertyKind, propertyValue);
     }
 
@@ -32,6 +42,73 @@ namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
         return make<ComputeSystemProperty>(propertyValue, propertyName, icon);
     }
 
+    Projection::ComputeSystemProperty ComputeSystemProperty::CreateUInt64(Projection::ComputeSystemPropertyKind const& propertyKind, uint64_t propertyValue)
+    {
+        ThrowIfCustom(propertyKind);
+        return make<ComputeSystemProperty>(propertyKind, PropertyValue{ std::in_place_type<uint64_t>, propertyValue });
+    }
+
+    Projection::ComputeSystemProperty ComputeSystemProperty::CreateDouble(Projection::ComputeSystemPropertyKind const& propertyKind, double propertyValue)
+    {
+        ThrowIfCustom(propertyKind);
+        return make<ComputeSystemProperty>(propertyKind, PropertyValue{ std::in_place_type<double>, propertyValue });
+    }
+
+    Projection::ComputeSystemProperty ComputeSystemProperty::CreateString(Projection::ComputeSystemPropertyKind const& propertyKind, hstring const& propertyValue)
+    {
+        ThrowIfCustom(propertyKind);
+        return make<ComputeSystemProperty>(propertyKind, PropertyValue{ std::in_place_type<hstring>, propertyValue });
+    }
+
+    Projection::ComputeSystemProperty ComputeSystemProperty::CreateDateTime(Projection::ComputeSystemPropertyKind const& propertyKind, DateTime const& propertyValue)
+    {
+        ThrowIfCustom(propertyKind);
+        return make<ComputeSystemProperty>(propertyKind, PropertyValue{ std::in_place_type<DateTime>, propertyValue });
+    }
+
+    // Only uses the projected members, so properties created by another copy of the SDK are copied as well.
+    Projection::ComputeSystemPropertyEntry ComputeSystemProperty::ToEntry(Projection::ComputeSystemProperty const& property)
+    {
+        Projection::ComputeSystemPropertyEntry entry{};
+        entry.PropertyKind = property.PropertyKind();
+        entry.Name = property.Name();
+        if (auto icon = property.Icon())
+        {
+            entry.Icon = icon.AbsoluteUri();
+        }
+
+        entry.ValueType = property.ValueType();
+        switch (entry.ValueType)
+        {
+        case PropertyType::UInt8:
+        case PropertyType::UInt16:
+        case PropertyType::UInt32:
+        case PropertyType::UInt64:
+            entry.ValueType = PropertyType::UInt64;
+            entry.UInt64Value = property.UInt64Value();
+            break;
+        case PropertyType::Int16:
+        case PropertyType::Int32:
+        case PropertyType::Int64:
+            entry.ValueType = PropertyType::Int64;
+            entry.Int64Value = property.Value().as<IPropertyValue>().GetInt64();
+            break;
+        case PropertyType::Single:
+        case PropertyType::Double:
+            entry.ValueType = PropertyType::Double;
+            entry.DoubleValue = property.DoubleValue();
+            break;
+        case PropertyType::String:
+            entry.StringValue = property.StringValue();
+            break;
+        case PropertyType::DateTime:
+            entry.DateTimeValue = property.DateTimeValue();
+            break;
+        }
+
+        return entry;
+    }
+
     Uri ComputeSystemProperty::Icon()
     {
         return m_icon;
@@ -42,13 +119,116 @@ namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
         return m_name;
     }
 
+    // Inline values are boxed on request so callers that only know about Value keep working.
     IInspectable ComputeSystemProperty::Value()
     {
-        return m_value;
+        return std::visit(
+            [](auto const& value) -> IInspectable {
+                if constexpr (std::is_same_v<std::decay_t<decltype(value)>, IInspectable>)
+                {
+                    return value;
+                }
+                else
+                {
+                    return box_value(value);
+                }
+            },
+            m_value);
     }
 
     ComputeSystemPropertyKind ComputeSystemProperty::PropertyKind()
     {
         return m_propertyKind;
     }
+
+    PropertyType ComputeSystemProperty::ValueType()
+    {
+        if (std::holds_alternative<uint64_t>(m_value))
+        {
+            return PropertyType::UInt64;
+        }
+
+        if (std::holds_alternative<double>(m_value))
+        {
+            return PropertyType::Double;
+        }
+
+        if (std::holds_alternative<hstring>(m_value))
+        {
+            return PropertyType::String;
+        }
+
+        if (std::holds_alternative<DateTime>(m_value))
+        {
+            return PropertyType::DateTime;
+        }
+
+        auto const& value = std::get<IInspectable>(m_value);
+        if (!value)
+        {
+            return PropertyType::Empty;
+        }
+
+        auto propertyValue = value.try_as<IPropertyValue>();
+        return propertyValue ? propertyValue.Type() : PropertyType::Inspectable;
+    }
+
+    uint64_t ComputeSystemProperty::UInt64Value()
+    {
+        if (auto value = std::get_if<uint64_t>(&m_value))
+        {
+            return *value;
+        }
+
+        return BoxedPropertyValue().GetUInt64();
+    }
+
+    double ComputeSystemProperty::DoubleValue()
+    {
+        if (auto value = std::get_if<double>(&m_value))
+        {
+            return *value;
+        }
+
+        return BoxedPropertyValue().GetDouble();
+    }
+
+    hstring ComputeSystemProperty::StringValue()
+    {
+        if (auto value = std::get_if<hstring>(&m_value))
+        {
+            return *value;
+        }
+
+        return BoxedPropertyValue().GetString();
+    }
+
+    DateTime ComputeSystemProperty::DateTimeValue()
+    {
+        if (auto value = std::get_if<DateTime>(&m_value))
+        {
+            return *value;
+        }
+
+        return BoxedPropertyValue().GetDateTime();
+    }
+
+    // Used by the typed accessors for values passed to Create or CreateCustom. IPropertyValue converts between
+    // numeric types and throws for anything it can't convert.
+    IPropertyValue ComputeSystemProperty::BoxedPropertyValue()
+    {
+        auto const* inspectable = std::get_if<IInspectable>(&m_value);
+        IPropertyValue propertyValue{ nullptr };
+        if (inspectable && *inspectable)
+        {
+            propertyValue = inspectable->try_as<IPropertyValue>();
+        }
+
+        if (!propertyValue)
+        {
+            throw hresult_illegal_method_call(L"The value of the property can't be converted to the requested type.");
+        }
+
+        return propertyValue;
+    }
 }
@@ -8,22 +8,41 @@ namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
 {
     struct ComputeSystemProperty : ComputeSystemPropertyT<ComputeSystemProperty>
     {
+        // Values created with the typed Create methods are stored inline. IInspectable holds values passed to
+        // Create and CreateCustom.
+        using PropertyValue = std::variant<IInspectable, uint64_t, double, hstring, DateTime>;
+
         ComputeSystemProperty(ComputeSystemPropertyKind const& propertyKind, IInspectable const& propertyValue);
         ComputeSystemProperty(IInspectable const& propertyValue, hstring const& propertyName, Uri const& icon);
+        ComputeSystemProperty(ComputeSystemPropertyKind const& propertyKind, PropertyValue&& propertyValue);
 
         static Projection::ComputeSystemProperty Create(Projection::ComputeSystemPropertyKind const& propertyKind, IInspectable const& propertyValue);
         static Projection::ComputeSystemProperty CreateCustom(IInspectable const& propertyValue, hstring const& propertyName, Uri const& icon);
+        static Projection::ComputeSystemProperty CreateUInt64(Projection::ComputeSystemPropertyKind const& propertyKind, uint64_t propertyValue);
+        static Projection::ComputeSystemProperty CreateDouble(Projection::ComputeSystemPropertyKind const& propertyKind, double propertyValue);
+        static Projection::ComputeSystemProperty CreateString(Projection::ComputeSystemPropertyKind const& propertyKind, hstring const& propertyValue);
+        static Projection::ComputeSystemProperty CreateDateTime(Projection::ComputeSystemPropertyKind const& propertyKind, DateTime const& propertyValue);
+
+        // Copies a property into the by-value form used by ComputeSystemSnapshot.
+        static Projection::ComputeSystemPropertyEntry ToEntry(Projection::ComputeSystemProperty const& property);
 
         Uri Icon();
         hstring Name();
         IInspectable Value();
         ComputeSystemPropertyKind PropertyKind();
+        PropertyType ValueType();
+        uint64_t UInt64Value();
+        double DoubleValue();
+        hstring StringValue();
+        DateTime DateTimeValue();
 
     private:
+        static void ThrowIfCustom(Projection::ComputeSystemPropertyKind const& propertyKind);
+        IPropertyValue BoxedPropertyValue();
 
         Uri m_icon;
         hstring m_name;
-        IInspectable m_value;
+        PropertyValue m_value;
         ComputeSystemPropertyKind m_propertyKind;
     };
 }
@@ -0,0 +1,422 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "ComputeSystemProviderAggregator.h"
+#include "ComputeSystemProviderAggregator.g.cpp"
+#include "ComputeSystemAggregationResult.h"
+#include "ComputeSystemProviderQueryResult.h"
+#include "OperationTracker.h"
+
+using namespace winrt::Windows::Foundation::Collections;
+namespace Projection = winrt::Microsoft::Windows::DevHome::SDK;
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    namespace
+    {
+        struct QueryState
+        {
+            std::vector<IComputeSystem> computeSystems;
+            ComputeSystemProviderQueryStatus status{ ComputeSystemProviderQueryStatus::InProgress };
+
+            // The failed result of the provider, when status is Failed or TimedOut.
+            Projection::ComputeSystemsResult failure{ nullptr };
+            winrt::clock::time_point deadline;
+        };
+
+        // Shared between the aggregation and the completion and progress handlers of the providers.
+        struct AggregationState
+        {
+            explicit AggregationState(uint32_t queryCount) :
+                operations(queryCount), queries(queryCount)
+            {
+            }
+
+            OperationTracker operations;
+            std::mutex mutex;
+            std::vector<QueryState> queries;
+            std::vector<Projection::ComputeSystemProviderQueryResult> pendingReports;
+            uint32_t completedQueries{ 0 };
+        };
+
+        Projection::ComputeSystemsResult CreateComputeSystemsResult(std::vector<IComputeSystem> computeSystems)
+        {
+            return Projection::ComputeSystemsResult(winrt::single_threaded_vector<IComputeSystem>(std::move(computeSystems)));
+        }
+
+        Projection::ComputeSystemsResult CreateFailureResult(winrt::hresult const& e, hstring const& diagnosticText)
+        {
+            return Projection::ComputeSystemsResult(e, diagnosticText, diagnosticText);
+        }
+
+        std::vector<IComputeSystem> GetComputeSystems(Projection::ComputeSystemsResult const& result)
+        {
+            std::vector<IComputeSystem> computeSystems;
+            if (auto iterable = result.ComputeSystems())
+            {
+                for (auto const& computeSystem : iterable)
+                {
+                    computeSystems.push_back(computeSystem);
+                }
+            }
+
+            return computeSystems;
+        }
+
+        void ReportBatch(std::shared_ptr<AggregationState> const& state, uint32_t queryIndex, Projection::ComputeSystemsResult const& batch)
+        {
+            std::vector<IComputeSystem> computeSystems;
+            try
+            {
+                if (batch && batch.Result().Status() == ProviderOperationStatus::Success)
+                {
+                    computeSystems = GetComputeSystems(batch);
+                }
+            }
+            catch (hresult_error const&)
+            {
+                // A batch that can't be read is reported as is, Dev Home sees the error when it reads it.
+            }
+
+            {
+                std::lock_guard lock(state->mutex);
+                auto& query = state->queries[queryIndex];
+                if (query.status != ComputeSystemProviderQueryStatus::InProgress)
+                {
+                    return;
+                }
+
+                query.computeSystems.insert(query.computeSystems.end(), computeSystems.begin(), computeSystems.end());
+                state->pendingReports.push_back(make<ComputeSystemProviderQueryResult>(queryIndex, ComputeSystemProviderQueryStatus::InProgress, batch));
+            }
+
+            state->operations.NotifyChanged();
+        }
+
+        // Records the final status of a query. newComputeSystems are the compute systems that weren't reported
+        // in a batch before.
+        void CompleteQuery(
+            std::shared_ptr<AggregationState> const& state,
+            uint32_t queryIndex,
+            ComputeSystemProviderQueryStatus status,
+            std::vector<IComputeSystem> newComputeSystems,
+            Projection::ComputeSystemsResult const& failure)
+        {
+            {
+                std::lock_guard lock(state->mutex);
+                auto& query = state->queries[queryIndex];
+                if (query.status != ComputeSystemProviderQueryStatus::InProgress)
+                {
+                    return;
+                }
+
+                query.status = status;
+                query.failure = failure;
+                query.computeSystems.insert(query.computeSystems.end(), newComputeSystems.begin(), newComputeSystems.end());
+                state->completedQueries++;
+                state->pendingReports.push_back(make<ComputeSystemProviderQueryResult>(
+                    queryIndex,
+                    status,
+                    failure ? failure : CreateComputeSystemsResult(std::move(newComputeSystems))));
+            }
+
+            state->operations.Complete(queryIndex);
+        }
+
+        void CompleteQuery(std::shared_ptr<AggregationState> const& state, uint32_t queryIndex, Projection::ComputeSystemsResult const& result)
+        {
+            try
+            {
+                auto providerResult = result.Result();
+                if (providerResult.Status() == ProviderOperationStatus::Success)
+                {
+                    CompleteQuery(state, queryIndex, ComputeSystemProviderQueryStatus::Completed, GetComputeSystems(result), nullptr);
+                }
+                else
+                {
+                    CompleteQuery(state, queryIndex, ComputeSystemProviderQueryStatus::Failed, {}, result);
+                }
+            }
+            catch (hresult_error const& error)
+            {
+                CompleteQuery(state, queryIndex, ComputeSystemProviderQueryStatus::Failed, {}, CreateFailureResult(error.code(), error.message()));
+            }
+        }
+
+        void FailQuery(std::shared_ptr<AggregationState> const& state, uint32_t queryIndex, AsyncStatus status, winrt::hresult const& errorCode)
+        {
+            auto e = status == AsyncStatus::Canceled ? HRESULT_FROM_WIN32(ERROR_CANCELLED) : static_cast<HRESULT>(errorCode);
+            CompleteQuery(state, queryIndex, ComputeSystemProviderQueryStatus::Failed, {}, CreateFailureResult(e, L"The provider didn't return compute systems."));
+        }
+
+        // Completes a query whose batches went missing with the full list of the provider. Only the compute
+        // systems that weren't reported in a batch are added, the ones that were are recognized by their id.
+        void CompleteRetrievedQuery(std::shared_ptr<AggregationState> const& state, uint32_t queryIndex, Projection::ComputeSystemsResult const& result)
+        {
+            try
+            {
+                if (result.Result().Status() != ProviderOperationStatus::Success)
+                {
+                    CompleteQuery(state, queryIndex, ComputeSystemProviderQueryStatus::Failed, {}, result);
+                    return;
+                }
+
+                std::vector<IComputeSystem> reportedComputeSystems;
+                {
+                    std::lock_guard lock(state->mutex);
+                    reportedComputeSystems = state->queries[queryIndex].computeSystems;
+                }
+
+                std::unordered_set<hstring> reportedIds;
+                for (auto const& computeSystem : reportedComputeSystems)
+                {
+                    reportedIds.insert(computeSystem.Id());
+                }
+
+                std::vector<IComputeSystem> newComputeSystems;
+                for (auto const& computeSystem : GetComputeSystems(result))
+                {
+                    if (reportedIds.find(computeSystem.Id()) == reportedIds.end())
+                    {
+                        newComputeSystems.push_back(computeSystem);
+                    }
+                }
+
+                CompleteQuery(state, queryIndex, ComputeSystemProviderQueryStatus::Completed, std::move(newComputeSystems), nullptr);
+            }
+            catch (hresult_error const& error)
+            {
+                CompleteQuery(state, queryIndex, ComputeSystemProviderQueryStatus::Failed, {}, CreateFailureResult(error.code(), error.message()));
+            }
+        }
+
+        // Batches reported before the progress handler was registered are lost. The summary tells how many
+        // compute systems the provider reported, so when fewer arrived the full list is retrieved instead.
+        void CompleteQuery(
+            std::shared_ptr<AggregationState> const& state,
+            uint32_t queryIndex,
+            Projection::ComputeSystemProviderQuery const& query,
+            Projection::ComputeSystemsSummaryResult const& summary)
+        {
+            try
+            {
+                auto providerResult = summary.Result();
+                if (providerResult.Status() == ProviderOperationStatus::Success)
+                {
+                    size_t receivedCount;
+                    {
+                        std::lock_guard lock(state->mutex);
+                        receivedCount = state->queries[queryIndex].computeSystems.size();
+                    }
+
+                    if (receivedCount >= summary.ComputeSystemCount())
+                    {
+                        CompleteQuery(state, queryIndex, ComputeSystemProviderQueryStatus::Completed, {}, nullptr);
+                        return;
+                    }
+
+                    auto operation = query.Provider().GetComputeSystemsAsync(query.DeveloperId());
+                    state->operations.Track(queryIndex, operation);
+                    operation.Completed([state, queryIndex](auto const& sender, AsyncStatus status) {
+                        if (status == AsyncStatus::Completed)
+                        {
+                            CompleteRetrievedQuery(state, queryIndex, sender.GetResults());
+                        }
+                        else
+                        {
+                            FailQuery(state, queryIndex, status, sender.ErrorCode());
+                        }
+                    });
+                }
+                else
+                {
+                    CompleteQuery(
+                        state,
+                        queryIndex,
+                        ComputeSystemProviderQueryStatus::Failed,
+                        {},
+                        Projection::ComputeSystemsResult(providerResult.ExtendedError(), providerResult.DisplayMessage(), providerResult.DiagnosticText()));
+                }
+            }
+            catch (hresult_error const& error)
+            {
+                CompleteQuery(state, queryIndex, ComputeSystemProviderQueryStatus::Failed, {}, CreateFailureResult(error.code(), error.message()));
+            }
+        }
+
+        void StartQuery(std::shared_ptr<AggregationState> const& state, Projection::ComputeSystemProviderQuery const& query, uint32_t queryIndex)
+        {
+            if (!query)
+            {
+                CompleteQuery(state, queryIndex, ComputeSystemProviderQueryStatus::Failed, {}, CreateFailureResult(E_INVALIDARG, L"The query is null."));
+                return;
+            }
+
+            try
+            {
+                auto provider = query.Provider();
+                auto developerId = query.DeveloperId();
+                if (auto provider2 = provider.try_as<IComputeSystemProvider2>())
+                {
+                    auto operation = provider2.GetComputeSystemsInBatchesAsync(developerId);
+                    state->operations.Track(queryIndex, operation);
+                    operation.Progress([state, queryIndex](auto const&, Projection::ComputeSystemsResult const& batch) {
+                        ReportBatch(state, queryIndex, batch);
+                    });
+                    operation.Completed([state, queryIndex, query](auto const& sender, AsyncStatus status) {
+                        if (status == AsyncStatus::Completed)
+                        {
+                            CompleteQuery(state, queryIndex, query, sender.GetResults());
+                        }
+                        else
+                        {
+                            FailQuery(state, queryIndex, status, sender.ErrorCode());
+                        }
+                    });
+                }
+                else
+                {
+                    auto operation = provider.GetComputeSystemsAsync(developerId);
+                    state->operations.Track(queryIndex, operation);
+                    operation.Completed([state, queryIndex](auto const& sender, AsyncStatus status) {
+                        if (status == AsyncStatus::Completed)
+                        {
+                            CompleteQuery(state, queryIndex, sender.GetResults());
+                        }
+                        else
+                        {
+                            FailQuery(state, queryIndex, status, sender.ErrorCode());
+                        }
+                    });
+                }
+            }
+            catch (hresult_error const& error)
+            {
+                CompleteQuery(state, queryIndex, ComputeSystemProviderQueryStatus::Failed, {}, CreateFailureResult(error.code(), error.message()));
+            }
+        }
+
+        // Cancels the operations of the queries whose deadline has passed and reports them as TimedOut. Returns
+        // the earliest deadline of the queries that are still in progress.
+        winrt::clock::time_point TimeOutQueries(std::shared_ptr<AggregationState> const& state, winrt::clock::time_point now)
+        {
+            std::vector<uint32_t> timedOutQueries;
+            auto nextDeadline = winrt::clock::time_point::max();
+            {
+                std::lock_guard lock(state->mutex);
+                for (uint32_t queryIndex = 0; queryIndex < state->queries.size(); queryIndex++)
+                {
+                    auto& query = state->queries[queryIndex];
+                    if (query.status != ComputeSystemProviderQueryStatus::InProgress)
+                    {
+                        continue;
+                    }
+
+                    if (now < query.deadline)
+                    {
+                        nextDeadline = (std::min)(nextDeadline, query.deadline);
+                        continue;
+                    }
+
+                    query.status = ComputeSystemProviderQueryStatus::TimedOut;
+                    query.failure = CreateFailureResult(HRESULT_FROM_WIN32(ERROR_TIMEOUT), L"The provider didn't return compute systems before the deadline.");
+                    state->completedQueries++;
+                    state->pendingReports.push_back(make<ComputeSystemProviderQueryResult>(queryIndex, query.status, query.failure));
+                    timedOutQueries.push_back(queryIndex);
+                }
+            }
+
+            for (auto queryIndex : timedOutQueries)
+            {
+                state->operations.Cancel(queryIndex);
+            }
+
+            return nextDeadline;
+        }
+    }
+
+    ComputeSystemProviderAggregator::ComputeSystemProviderAggregator(TimeSpan const& providerDeadline) :
+        m_providerDeadline(providerDeadline)
+    {
+        if (providerDeadline <= TimeSpan::zero())
+        {
+            throw hresult_invalid_argument(L"providerDeadline parameter should be greater than 0.");
+        }
+    }
+
+    TimeSpan ComputeSystemProviderAggregator::ProviderDeadline()
+    {
+        return m_providerDeadline;
+    }
+
+    IAsyncOperationWithProgress<Projection::ComputeSystemAggregationResult, Projection::ComputeSystemProviderQueryResult> ComputeSystemProviderAggregator::GetComputeSystemsAsync(
+        array_view<Projection::ComputeSystemProviderQuery const> queries)
+    {
+        // The array_view refers to the caller's memory, so it has to be copied before the first suspension.
+        std::vector<Projection::ComputeSystemProviderQuery> providerQueries{ queries.begin(), queries.end() };
+        auto strongThis = get_strong();
+        auto cancellation = co_await get_cancellation_token();
+        auto progress = co_await get_progress_token();
+
+        auto totalCount = static_cast<uint32_t>(providerQueries.size());
+        auto state = std::make_shared<AggregationState>(totalCount);
+        cancellation.callback([state]() {
+            state->operations.CancelAll();
+        });
+
+        // Every query starts at once, so the deadlines are counted from the same time.
+        auto startTime = winrt::clock::now();
+        for (uint32_t queryIndex = 0; queryIndex < totalCount; queryIndex++)
+        {
+            auto deadline = providerQueries[queryIndex] ? providerQueries[queryIndex].Deadline() : TimeSpan::zero();
+            state->queries[queryIndex].deadline = startTime + (deadline > TimeSpan::zero() ? deadline : m_providerDeadline);
+        }
+
+        for (uint32_t queryIndex = 0; queryIndex < totalCount; queryIndex++)
+        {
+            StartQuery(state, providerQueries[queryIndex], queryIndex);
+        }
+
+        while (true)
+        {
+            auto now = winrt::clock::now();
+            auto nextDeadline = TimeOutQueries(state, now);
+
+            std::vector<Projection::ComputeSystemProviderQueryResult> reports;
+            bool isCompleted;
+            {
+                std::lock_guard lock(state->mutex);
+                reports.swap(state->pendingReports);
+                isCompleted = state->completedQueries == totalCount;
+            }
+
+            for (auto const& report : reports)
+            {
+                progress(report);
+            }
+
+            if (isCompleted)
+            {
+                break;
+            }
+
+            // Throws when the aggregation is cancelled. Returns without the event being signaled at the next
+            // deadline. A query that is still in progress always has a deadline after now.
+            co_await state->operations.WaitForChange(nextDeadline - now);
+        }
+
+        std::vector<Projection::ComputeSystemProviderQueryResult> results;
+        results.reserve(totalCount);
+        for (uint32_t queryIndex = 0; queryIndex < totalCount; queryIndex++)
+        {
+            auto& query = state->queries[queryIndex];
+            results.push_back(make<ComputeSystemProviderQueryResult>(
+                queryIndex,
+                query.status,
+                query.failure ? query.failure : CreateComputeSystemsResult(std::move(query.computeSystems))));
+        }
+
+        co_return make<ComputeSystemAggregationResult>(results);
+    }
+}
@@ -0,0 +1,28 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include "ComputeSystemProviderAggregator.g.h"
+
+using namespace winrt::Windows::Foundation;
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    struct ComputeSystemProviderAggregator : ComputeSystemProviderAggregatorT<ComputeSystemProviderAggregator>
+    {
+        ComputeSystemProviderAggregator(TimeSpan const& providerDeadline);
+
+        TimeSpan ProviderDeadline();
+        IAsyncOperationWithProgress<winrt::Microsoft::Windows::DevHome::SDK::ComputeSystemAggregationResult, winrt::Microsoft::Windows::DevHome::SDK::ComputeSystemProviderQueryResult> GetComputeSystemsAsync(
+            array_view<winrt::Microsoft::Windows::DevHome::SDK::ComputeSystemProviderQuery const> queries);
+
+    private:
+        TimeSpan m_providerDeadline;
+    };
+}
+namespace winrt::Microsoft::Windows::DevHome::SDK::factory_implementation
+{
+    struct ComputeSystemProviderAggregator : ComputeSystemProviderAggregatorT<ComputeSystemProviderAggregator, implementation::ComputeSystemProviderAggregator>
+    {
+    };
+}
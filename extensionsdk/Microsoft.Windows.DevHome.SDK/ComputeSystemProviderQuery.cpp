@@ -0,0 +1,47 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "ComputeSystemProviderQuery.h"
+#include "ComputeSystemProviderQuery.g.cpp"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    ComputeSystemProviderQuery::ComputeSystemProviderQuery(IComputeSystemProvider const& provider, IDeveloperId const& developerId) :
+        m_provider(provider), m_developerId(developerId), m_deadline()
+    {
+        if (!provider)
+        {
+            throw hresult_invalid_argument(L"provider parameter should not be null.");
+        }
+    }
+
+    ComputeSystemProviderQuery::ComputeSystemProviderQuery(IComputeSystemProvider const& provider, IDeveloperId const& developerId, winrt::Windows::Foundation::TimeSpan const& deadline) :
+        m_provider(provider), m_developerId(developerId), m_deadline(deadline)
+    {
+        if (!provider)
+        {
+            throw hresult_invalid_argument(L"provider parameter should not be null.");
+        }
+
+        if (deadline <= winrt::Windows::Foundation::TimeSpan::zero())
+        {
+            throw hresult_invalid_argument(L"deadline parameter should be greater than 0.");
+        }
+    }
+
+    IComputeSystemProvider ComputeSystemProviderQuery::Provider()
+    {
+        return m_provider;
+    }
+
+    IDeveloperId ComputeSystemProviderQuery::DeveloperId()
+    {
+        return m_developerId;
+    }
+
+    winrt::Windows::Foundation::TimeSpan ComputeSystemProviderQuery::Deadline()
+    {
+        return m_deadline;
+    }
+}
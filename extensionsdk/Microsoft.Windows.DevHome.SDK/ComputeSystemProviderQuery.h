@@ -0,0 +1,29 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include "ComputeSystemProviderQuery.g.h"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    struct ComputeSystemProviderQuery : ComputeSystemProviderQueryT<ComputeSystemProviderQuery>
+    {
+        ComputeSystemProviderQuery(IComputeSystemProvider const& provider, IDeveloperId const& developerId);
+        ComputeSystemProviderQuery(IComputeSystemProvider const& provider, IDeveloperId const& developerId, winrt::Windows::Foundation::TimeSpan const& deadline);
+
+        IComputeSystemProvider Provider();
+        IDeveloperId DeveloperId();
+        winrt::Windows::Foundation::TimeSpan Deadline();
+
+    private:
+        IComputeSystemProvider m_provider;
+        IDeveloperId m_developerId;
+        winrt::Windows::Foundation::TimeSpan m_deadline;
+    };
+}
+namespace winrt::Microsoft::Windows::DevHome::SDK::factory_implementation
+{
+    struct ComputeSystemProviderQuery : ComputeSystemProviderQueryT<ComputeSystemProviderQuery, implementation::ComputeSystemProviderQuery>
+    {
+    };
+}
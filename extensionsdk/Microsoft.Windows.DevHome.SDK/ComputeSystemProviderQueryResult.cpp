@@ -0,0 +1,29 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "ComputeSystemProviderQueryResult.h"
+#include "ComputeSystemProviderQueryResult.g.cpp"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    ComputeSystemProviderQueryResult::ComputeSystemProviderQueryResult(uint32_t queryIndex, ComputeSystemProviderQueryStatus const& status, ComputeSystemsResult const& computeSystems) :
+        m_queryIndex(queryIndex), m_status(status), m_computeSystems(computeSystems)
+    {
+    }
+
+    uint32_t ComputeSystemProviderQueryResult::QueryIndex()
+    {
+        return m_queryIndex;
+    }
+
+    ComputeSystemProviderQueryStatus ComputeSystemProviderQueryResult::Status()
+    {
+        return m_status;
+    }
+
+    ComputeSystemsResult ComputeSystemProviderQueryResult::ComputeSystems()
+    {
+        return m_computeSystems;
+    }
+}
@@ -0,0 +1,28 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include "ComputeSystemProviderQueryResult.g.h"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    struct ComputeSystemProviderQueryResult : ComputeSystemProviderQueryResultT<ComputeSystemProviderQueryResult>
+    {
+        ComputeSystemProviderQueryResult(uint32_t queryIndex, ComputeSystemProviderQueryStatus const& status, ComputeSystemsResult const& computeSystems);
+
+        uint32_t QueryIndex();
+        ComputeSystemProviderQueryStatus Status();
+        ComputeSystemsResult ComputeSystems();
+
+    private:
+        uint32_t m_queryIndex;
+        ComputeSystemProviderQueryStatus m_status;
+        ComputeSystemsResult m_computeSystems;
+    };
+}
+namespace winrt::Microsoft::Windows::DevHome::SDK::factory_implementation
+{
+    struct ComputeSystemProviderQueryResult : ComputeSystemProviderQueryResultT<ComputeSystemProviderQueryResult, implementation::ComputeSystemProviderQueryResult>
+    {
+    };
+}
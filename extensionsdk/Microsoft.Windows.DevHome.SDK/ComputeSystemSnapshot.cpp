@@ -0,0 +1,204 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "ComputeSystemSnapshot.h"
+#include "ComputeSystemSnapshot.g.cpp"
+#include "ComputeSystemProperty.h"
+
+using namespace winrt::Windows::Storage::Streams;
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    namespace
+    {
+        bool HasField(ComputeSystemSnapshotFields fields, ComputeSystemSnapshotFields field)
+        {
+            return (fields & field) == field;
+        }
+
+        // Failed results are reported with a failure code, even when the extension didn't set one.
+        winrt::hresult GetFailureCode(ProviderOperationResult const& result)
+        {
+            winrt::hresult error = result.ExtendedError();
+            return (error < 0) ? error : winrt::hresult{ E_FAIL };
+        }
+    }
+
+    ComputeSystemSnapshot::ComputeSystemSnapshot(ComputeSystemSnapshotData const& data, array_view<ComputeSystemPropertyEntry const> properties, IBuffer const& thumbnail) :
+        m_data(data),
+        m_properties(properties.begin(), properties.end()),
+        m_thumbnail(thumbnail ? thumbnail : CreateEmptyBuffer()),
+        m_result(ProviderOperationStatus::Success, S_OK, hstring(), hstring())
+    {
+    }
+
+    ComputeSystemSnapshot::ComputeSystemSnapshot(ComputeSystemSnapshotData const& data, std::vector<ComputeSystemPropertyEntry>&& properties, IBuffer const& thumbnail) :
+        m_data(data),
+        m_properties(std::move(properties)),
+        m_thumbnail(thumbnail ? thumbnail : CreateEmptyBuffer()),
+        m_result(ProviderOperationStatus::Success, S_OK, hstring(), hstring())
+    {
+    }
+
+    ComputeSystemSnapshot::ComputeSystemSnapshot(winrt::hresult const& e, hstring const& displayMessage, hstring const& diagnosticText) :
+        m_data(),
+        m_properties(),
+        m_thumbnail(CreateEmptyBuffer()),
+        m_result(ProviderOperationStatus::Failure, e, displayMessage, diagnosticText)
+    {
+    }
+
+    IAsyncOperation<winrt::Microsoft::Windows::DevHome::SDK::ComputeSystemSnapshot> ComputeSystemSnapshot::CreateAsync(IComputeSystem computeSystem, ComputeSystemSnapshotFields fields)
+    {
+        // Start every requested operation before awaiting any of them so they run at the same time.
+        IAsyncOperation<winrt::Microsoft::Windows::DevHome::SDK::ComputeSystemStateResult> stateOperation{ nullptr };
+        IAsyncOperation<IIterable<winrt::Microsoft::Windows::DevHome::SDK::ComputeSystemProperty>> propertiesOperation{ nullptr };
+        IAsyncOperation<winrt::Microsoft::Windows::DevHome::SDK::ComputeSystemThumbnailResult> thumbnailOperation{ nullptr };
+        try
+        {
+            if (HasField(fields, ComputeSystemSnapshotFields::State))
+            {
+                stateOperation = computeSystem.GetStateAsync();
+            }
+
+            if (HasField(fields, ComputeSystemSnapshotFields::Properties))
+            {
+                propertiesOperation = computeSystem.GetComputeSystemPropertiesAsync(hstring());
+            }
+
+            if (HasField(fields, ComputeSystemSnapshotFields::Thumbnail))
+            {
+                thumbnailOperation = computeSystem.GetComputeSystemThumbnailAsync(hstring());
+            }
+        }
+        catch (hresult_error const& ex)
+        {
+            co_return make<ComputeSystemSnapshot>(ex.code(), ex.message(), ex.message());
+        }
+
+        ComputeSystemSnapshotData data{};
+        data.Fields = fields;
+        try
+        {
+            if (HasField(fields, ComputeSystemSnapshotFields::DisplayName))
+            {
+                data.DisplayName = computeSystem.DisplayName();
+            }
+
+            if (HasField(fields, ComputeSystemSnapshotFields::SupplementalDisplayName))
+            {
+                data.SupplementalDisplayName = computeSystem.SupplementalDisplayName();
+            }
+
+            if (HasField(fields, ComputeSystemSnapshotFields::SupportedOperations))
+            {
+                data.SupportedOperations = computeSystem.SupportedOperations();
+            }
+        }
+        catch (hresult_error const& ex)
+        {
+            co_return make<ComputeSystemSnapshot>(ex.code(), ex.message(), ex.message());
+        }
+
+        // A failure in one of the operations is reported in its own error field, so the other fields can still
+        // be displayed.
+        if (stateOperation)
+        {
+            try
+            {
+                auto state = co_await stateOperation;
+                auto result = state.Result();
+                if (result.Status() == ProviderOperationStatus::Success)
+                {
+                    data.State = state.State();
+                }
+                else
+                {
+                    data.StateError = GetFailureCode(result);
+                    data.StateDiagnosticText = result.DiagnosticText();
+                }
+            }
+            catch (hresult_error const& ex)
+            {
+                data.StateError = ex.code();
+                data.StateDiagnosticText = ex.message();
+            }
+        }
+
+        std::vector<ComputeSystemPropertyEntry> properties;
+        if (propertiesOperation)
+        {
+            try
+            {
+                if (auto computeSystemProperties = co_await propertiesOperation)
+                {
+                    for (auto const& property : computeSystemProperties)
+                    {
+                        properties.push_back(ComputeSystemProperty::ToEntry(property));
+                    }
+                }
+            }
+            catch (hresult_error const& ex)
+            {
+                // Partially copied properties would look like a complete list, so none are returned.
+                properties.clear();
+                data.PropertiesError = ex.code();
+                data.PropertiesDiagnosticText = ex.message();
+            }
+        }
+
+        IBuffer thumbnail{ nullptr };
+        if (thumbnailOperation)
+        {
+            try
+            {
+                auto thumbnailResult = co_await thumbnailOperation;
+                auto result = thumbnailResult.Result();
+                if (result.Status() == ProviderOperationStatus::Success)
+                {
+                    thumbnail = thumbnailResult.Thumbnail();
+                }
+                else
+                {
+                    data.ThumbnailError = GetFailureCode(result);
+                    data.ThumbnailDiagnosticText = result.DiagnosticText();
+                }
+            }
+            catch (hresult_error const& ex)
+            {
+                data.ThumbnailError = ex.code();
+                data.ThumbnailDiagnosticText = ex.message();
+            }
+        }
+
+        co_return make<ComputeSystemSnapshot>(data, std::move(properties), thumbnail);
+    }
+
+    ComputeSystemSnapshotData ComputeSystemSnapshot::Data()
+    {
+        return m_data;
+    }
+
+    com_array<ComputeSystemPropertyEntry> ComputeSystemSnapshot::Properties()
+    {
+        return com_array<ComputeSystemPropertyEntry>(m_properties.begin(), m_properties.end());
+    }
+
+    IBuffer ComputeSystemSnapshot::Thumbnail()
+    {
+        return m_thumbnail;
+    }
+
+    ProviderOperationResult ComputeSystemSnapshot::Result()
+    {
+        return m_result;
+    }
+
+    IBuffer ComputeSystemSnapshot::CreateEmptyBuffer()
+    {
+        Buffer buffer{ 0 };
+        buffer.Length(0);
+        return buffer;
+    }
+}
@@ -0,0 +1,40 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include "ComputeSystemSnapshot.g.h"
+
+using namespace winrt::Windows::Foundation;
+using namespace winrt::Windows::Foundation::Collections;
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    struct ComputeSystemSnapshot : ComputeSystemSnapshotT<ComputeSystemSnapshot>
+    {
+        ComputeSystemSnapshot(ComputeSystemSnapshotData const& data, array_view<ComputeSystemPropertyEntry const> properties, winrt::Windows::Storage::Streams::IBuffer const& thumbnail);
+        ComputeSystemSnapshot(ComputeSystemSnapshotData const& data, std::vector<ComputeSystemPropertyEntry>&& properties, winrt::Windows::Storage::Streams::IBuffer const& thumbnail);
+        ComputeSystemSnapshot(winrt::hresult const& e, hstring const& displayMessage, hstring const& diagnosticText);
+
+        static IAsyncOperation<winrt::Microsoft::Windows::DevHome::SDK::ComputeSystemSnapshot> CreateAsync(IComputeSystem computeSystem, ComputeSystemSnapshotFields fields);
+
+        ComputeSystemSnapshotData Data();
+        com_array<ComputeSystemPropertyEntry> Properties();
+        winrt::Windows::Storage::Streams::IBuffer Thumbnail();
+        ProviderOperationResult Result();
+
+    private:
+        static winrt::Windows::Storage::Streams::IBuffer CreateEmptyBuffer();
+
+        ComputeSystemSnapshotData m_data;
+        std::vector<ComputeSystemPropertyEntry> m_properties;
+        winrt::Windows::Storage::Streams::IBuffer m_thumbnail;
+        ProviderOperationResult m_result;
+    };
+}
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::factory_implementation
+{
+    struct ComputeSystemSnapshot : ComputeSystemSnapshotT<ComputeSystemSnapshot, implementation::ComputeSystemSnapshot>
+    {
+    };
+}
@@ -0,0 +1,52 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "ComputeSystemSnapshotProgressEstimator.h"
+#include "ComputeSystemSnapshotProgressEstimator.g.cpp"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    namespace
+    {
+        // Weight of the latest sample in the moving average of the processing rate.
+        constexpr double RateSmoothingFactor = 0.2;
+    }
+
+    ComputeSystemSnapshotProgressEstimator::ComputeSystemSnapshotProgressEstimator(uint64_t totalBytes) :
+        m_totalBytes(totalBytes)
+    {
+    }
+
+    uint64_t ComputeSystemSnapshotProgressEstimator::TotalBytes()
+    {
+        return m_totalBytes;
+    }
+
+    ComputeSystemSnapshotOperationProgress ComputeSystemSnapshotProgressEstimator::Update(uint64_t bytesProcessed)
+    {
+        auto now = std::chrono::steady_clock::now();
+        std::lock_guard lock(m_mutex);
+        if (m_lastUpdateTime && bytesProcessed >= m_lastBytesProcessed)
+        {
+            auto elapsedSeconds = std::chrono::duration<double>(now - *m_lastUpdateTime).count();
+            if (elapsedSeconds > 0)
+            {
+                auto bytesPerSecond = static_cast<double>(bytesProcessed - m_lastBytesProcessed) / elapsedSeconds;
+                m_bytesPerSecond = m_bytesPerSecond == 0 ? bytesPerSecond : m_bytesPerSecond + RateSmoothingFactor * (bytesPerSecond - m_bytesPerSecond);
+            }
+        }
+
+        m_lastBytesProcessed = bytesProcessed;
+        m_lastUpdateTime = now;
+
+        winrt::Windows::Foundation::TimeSpan estimatedTimeRemaining{};
+        if (m_totalBytes > bytesProcessed && m_bytesPerSecond > 0)
+        {
+            auto remainingSeconds = static_cast<double>(m_totalBytes - bytesProcessed) / m_bytesPerSecond;
+            estimatedTimeRemaining = std::chrono::duration_cast<winrt::Windows::Foundation::TimeSpan>(std::chrono::duration<double>(remainingSeconds));
+        }
+
+        return ComputeSystemSnapshotOperationProgress{ bytesProcessed, m_totalBytes, estimatedTimeRemaining };
+    }
+}
@@ -0,0 +1,31 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include "ComputeSystemSnapshotProgressEstimator.g.h"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    struct ComputeSystemSnapshotProgressEstimator : ComputeSystemSnapshotProgressEstimatorT<ComputeSystemSnapshotProgressEstimator>
+    {
+        ComputeSystemSnapshotProgressEstimator(uint64_t totalBytes);
+
+        uint64_t TotalBytes();
+        ComputeSystemSnapshotOperationProgress Update(uint64_t bytesProcessed);
+
+    private:
+        std::mutex m_mutex;
+        uint64_t m_totalBytes;
+        uint64_t m_lastBytesProcessed{ 0 };
+        std::optional<std::chrono::steady_clock::time_point> m_lastUpdateTime;
+
+        // Moving average of the processing rate, 0 until two updates are recorded.
+        double m_bytesPerSecond{ 0 };
+    };
+}
+namespace winrt::Microsoft::Windows::DevHome::SDK::factory_implementation
+{
+    struct ComputeSystemSnapshotProgressEstimator : ComputeSystemSnapshotProgressEstimatorT<ComputeSystemSnapshotProgressEstimator, implementation::ComputeSystemSnapshotProgressEstimator>
+    {
+    };
+}
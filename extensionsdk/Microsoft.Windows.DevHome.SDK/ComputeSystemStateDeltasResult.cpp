@@ -0,0 +1,48 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "ComputeSystemStateDeltasResult.h"
+#include "ComputeSystemStateDeltasResult.g.cpp"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    ComputeSystemStateDeltasResult::ComputeSystemStateDeltasResult(winrt::guid const& journalId, array_view<ComputeSystemStateDelta const> deltas, uint64_t latestSequenceNumber, bool isFullState) :
+        m_deltas(deltas.begin(), deltas.end()),
+        m_journalId(journalId),
+        m_latestSequenceNumber(latestSequenceNumber),
+        m_isFullState(isFullState),
+        m_result(ProviderOperationStatus::Success, S_OK, hstring(), hstring())
+    {
+    }
+
+    ComputeSystemStateDeltasResult::ComputeSystemStateDeltasResult(winrt::hresult const& e, hstring const& displayMessage, hstring const& diagnosticText) :
+        m_deltas(), m_journalId(), m_latestSequenceNumber(0), m_isFullState(false), m_result(ProviderOperationStatus::Failure, e, displayMessage, diagnosticText)
+    {
+    }
+
+    com_array<ComputeSystemStateDelta> ComputeSystemStateDeltasResult::Deltas()
+    {
+        return com_array<ComputeSystemStateDelta>{ m_deltas.begin(), m_deltas.end() };
+    }
+
+    winrt::guid ComputeSystemStateDeltasResult::JournalId()
+    {
+        return m_journalId;
+    }
+
+    uint64_t ComputeSystemStateDeltasResult::LatestSequenceNumber()
+    {
+        return m_latestSequenceNumber;
+    }
+
+    bool ComputeSystemStateDeltasResult::IsFullState()
+    {
+        return m_isFullState;
+    }
+
+    ProviderOperationResult ComputeSystemStateDeltasResult::Result()
+    {
+        return m_result;
+    }
+}
@@ -0,0 +1,33 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include "ComputeSystemStateDeltasResult.g.h"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    struct ComputeSystemStateDeltasResult : ComputeSystemStateDeltasResultT<ComputeSystemStateDeltasResult>
+    {
+        ComputeSystemStateDeltasResult(winrt::guid const& journalId, array_view<ComputeSystemStateDelta const> deltas, uint64_t latestSequenceNumber, bool isFullState);
+        ComputeSystemStateDeltasResult(winrt::hresult const& e, hstring const& displayMessage, hstring const& diagnosticText);
+        com_array<ComputeSystemStateDelta> Deltas();
+        winrt::guid JournalId();
+        uint64_t LatestSequenceNumber();
+        bool IsFullState();
+        ProviderOperationResult Result();
+
+    private:
+        std::vector<ComputeSystemStateDelta> m_deltas;
+        winrt::guid m_journalId;
+        uint64_t m_latestSequenceNumber;
+        bool m_isFullState;
+        ProviderOperationResult m_result;
+    };
+}
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::factory_implementation
+{
+    struct ComputeSystemStateDeltasResult : ComputeSystemStateDeltasResultT<ComputeSystemStateDeltasResult, implementation::ComputeSystemStateDeltasResult>
+    {
+    };
+}
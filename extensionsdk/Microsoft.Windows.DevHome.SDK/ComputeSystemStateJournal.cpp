@@ -0,0 +1,130 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "ComputeSystemStateJournal.h"
+#include "ComputeSystemStateJournal.g.cpp"
+#include "ComputeSystemStateDeltasResult.h"
+
+namespace Projection = winrt::Microsoft::Windows::DevHome::SDK;
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    ComputeSystemStateJournal::ComputeSystemStateJournal(uint32_t historyCapacity, TimeSpan const& batchInterval) :
+        m_journalId(), m_historyCapacity(historyCapacity), m_batchInterval(batchInterval)
+    {
+        if (historyCapacity == 0)
+        {
+            throw hresult_invalid_argument(L"historyCapacity parameter should be at least 1.");
+        }
+
+        winrt::check_hresult(CoCreateGuid(reinterpret_cast<GUID*>(&m_journalId)));
+    }
+
+    winrt::guid ComputeSystemStateJournal::JournalId()
+    {
+        return m_journalId;
+    }
+
+    void ComputeSystemStateJournal::Append(hstring const& computeSystemId, ComputeSystemState const& state)
+    {
+        bool startDelivery;
+        {
+            std::lock_guard lock(m_mutex);
+            ComputeSystemStateDelta delta{ ++m_latestSequenceNumber, computeSystemId, state };
+            m_history.push_back(delta);
+            if (m_history.size() > m_historyCapacity)
+            {
+                m_history.pop_front();
+            }
+
+            if (state == ComputeSystemState::Deleted)
+            {
+                m_latestStates.erase(computeSystemId);
+            }
+            else
+            {
+                m_latestStates.insert_or_assign(computeSystemId, std::move(delta));
+            }
+
+            startDelivery = !m_isDeliveryPending;
+            m_isDeliveryPending = true;
+        }
+
+        if (startDelivery)
+        {
+            DeliverBatchAsync();
+        }
+    }
+
+    // A sequence number of another journal says nothing about this one, even when it is in range.
+    Projection::ComputeSystemStateDeltasResult ComputeSystemStateJournal::GetDeltasSince(winrt::guid const& journalId, uint64_t sequenceNumber)
+    {
+        std::lock_guard lock(m_mutex);
+        return CreateDeltasResult(journalId == m_journalId ? std::optional<uint64_t>{ sequenceNumber } : std::nullopt);
+    }
+
+    uint64_t ComputeSystemStateJournal::LatestSequenceNumber()
+    {
+        std::lock_guard lock(m_mutex);
+        return m_latestSequenceNumber;
+    }
+
+    winrt::event_token ComputeSystemStateJournal::DeltasAvailable(TypedEventHandler<Projection::ComputeSystemStateJournal, Projection::ComputeSystemStateDeltasResult> const& handler)
+    {
+        return m_deltasAvailable.add(handler);
+    }
+
+    void ComputeSystemStateJournal::DeltasAvailable(winrt::event_token const& token) noexcept
+    {
+        m_deltasAvailable.remove(token);
+    }
+
+    Projection::ComputeSystemStateDeltasResult ComputeSystemStateJournal::CreateDeltasResult(std::optional<uint64_t> sequenceNumber)
+    {
+        std::vector<ComputeSystemStateDelta> deltas;
+        auto oldestSequenceNumber = m_history.empty() ? m_latestSequenceNumber + 1 : m_history.front().SequenceNumber;
+        auto isFullState = !sequenceNumber || *sequenceNumber > m_latestSequenceNumber || *sequenceNumber + 1 < oldestSequenceNumber;
+        if (isFullState)
+        {
+            deltas.reserve(m_latestStates.size());
+            for (auto const& [computeSystemId, delta] : m_latestStates)
+            {
+                deltas.push_back(delta);
+            }
+
+            std::sort(deltas.begin(), deltas.end(), [](ComputeSystemStateDelta const& left, ComputeSystemStateDelta const& right) {
+                return left.SequenceNumber < right.SequenceNumber;
+            });
+        }
+        else
+        {
+            deltas.assign(m_history.begin() + static_cast<ptrdiff_t>(*sequenceNumber + 1 - oldestSequenceNumber), m_history.end());
+        }
+
+        return make<ComputeSystemStateDeltasResult>(m_journalId, deltas, m_latestSequenceNumber, isFullState);
+    }
+
+    // Waits for the batch interval so that the state changes appended in the meantime are delivered together.
+    winrt::fire_and_forget ComputeSystemStateJournal::DeliverBatchAsync()
+    {
+        auto weakThis = get_weak();
+        co_await winrt::resume_after(m_batchInterval);
+
+        auto strongThis = weakThis.get();
+        if (!strongThis)
+        {
+            co_return;
+        }
+
+        Projection::ComputeSystemStateDeltasResult result{ nullptr };
+        {
+            std::lock_guard lock(strongThis->m_mutex);
+            strongThis->m_isDeliveryPending = false;
+            result = strongThis->CreateDeltasResult(strongThis->m_deliveredSequenceNumber);
+            strongThis->m_deliveredSequenceNumber = strongThis->m_latestSequenceNumber;
+        }
+
+        strongThis->m_deltasAvailable(*strongThis, result);
+    }
+}
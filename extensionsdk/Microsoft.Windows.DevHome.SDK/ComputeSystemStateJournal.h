@@ -0,0 +1,51 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include "ComputeSystemStateJournal.g.h"
+
+using namespace winrt::Windows::Foundation;
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    struct ComputeSystemStateJournal : ComputeSystemStateJournalT<ComputeSystemStateJournal>
+    {
+        ComputeSystemStateJournal(uint32_t historyCapacity, TimeSpan const& batchInterval);
+
+        winrt::guid JournalId();
+        void Append(hstring const& computeSystemId, ComputeSystemState const& state);
+        winrt::Microsoft::Windows::DevHome::SDK::ComputeSystemStateDeltasResult GetDeltasSince(winrt::guid const& journalId, uint64_t sequenceNumber);
+        uint64_t LatestSequenceNumber();
+
+        winrt::event_token DeltasAvailable(TypedEventHandler<winrt::Microsoft::Windows::DevHome::SDK::ComputeSystemStateJournal, winrt::Microsoft::Windows::DevHome::SDK::ComputeSystemStateDeltasResult> const& handler);
+        void DeltasAvailable(winrt::event_token const& token) noexcept;
+
+    private:
+        // Must be called with m_mutex held. Returns the full state when sequenceNumber is empty.
+        winrt::Microsoft::Windows::DevHome::SDK::ComputeSystemStateDeltasResult CreateDeltasResult(std::optional<uint64_t> sequenceNumber);
+
+        winrt::fire_and_forget DeliverBatchAsync();
+
+        std::mutex m_mutex;
+        winrt::guid m_journalId;
+        uint32_t m_historyCapacity;
+        TimeSpan m_batchInterval;
+
+        // The last m_historyCapacity state changes. Their sequence numbers are consecutive.
+        std::deque<ComputeSystemStateDelta> m_history;
+
+        // The last state change of every compute system that hasn't been deleted.
+        std::unordered_map<hstring, ComputeSystemStateDelta> m_latestStates;
+
+        uint64_t m_latestSequenceNumber{ 0 };
+        uint64_t m_deliveredSequenceNumber{ 0 };
+        bool m_isDeliveryPending{ false };
+        winrt::event<TypedEventHandler<winrt::Microsoft::Windows::DevHome::SDK::ComputeSystemStateJournal, winrt::Microsoft::Windows::DevHome::SDK::ComputeSystemStateDeltasResult>> m_deltasAvailable;
+    };
+}
+namespace winrt::Microsoft::Windows::DevHome::SDK::factory_implementation
+{
+    struct ComputeSystemStateJournal : ComputeSystemStateJournalT<ComputeSystemStateJournal, implementation::ComputeSystemStateJournal>
+    {
+    };
+}
@@ -0,0 +1,29 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "ComputeSystemStatesResult.h"
+#include "ComputeSystemStatesResult.g.cpp"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    ComputeSystemStatesResult::ComputeSystemStatesResult(array_view<ComputeSystemStateEntry const> states) :
+        m_states(states.begin(), states.end()), m_result(ProviderOperationStatus::Success, S_OK, hstring(), hstring())
+    {
+    }
+
+    ComputeSystemStatesResult::ComputeSystemStatesResult(winrt::hresult const& e, hstring const& displayMessage, hstring const& diagnosticText) :
+        m_states(), m_result(ProviderOperationStatus::Failure, e, displayMessage, diagnosticText)
+    {
+    }
+
+    com_array<ComputeSystemStateEntry> ComputeSystemStatesResult::States()
+    {
+        return com_array<ComputeSystemStateEntry>{ m_states.begin(), m_states.end() };
+    }
+
+    ProviderOperationResult ComputeSystemStatesResult::Result()
+    {
+        return m_result;
+    }
+}
@@ -0,0 +1,27 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include "ComputeSystemStatesResult.g.h"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    struct ComputeSystemStatesResult : ComputeSystemStatesResultT<ComputeSystemStatesResult>
+    {
+        ComputeSystemStatesResult(array_view<ComputeSystemStateEntry const> states);
+        ComputeSystemStatesResult(winrt::hresult const& e, hstring const& displayMessage, hstring const& diagnosticText);
+        com_array<ComputeSystemStateEntry> States();
+        ProviderOperationResult Result();
+
+    private:
+        std::vector<ComputeSystemStateEntry> m_states;
+        ProviderOperationResult m_result;
+    };
+}
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::factory_implementation
+{
+    struct ComputeSystemStatesResult : ComputeSystemStatesResultT<ComputeSystemStatesResult, implementation::ComputeSystemStatesResult>
+    {
+    };
+}
@@ -2,25 +2,57 @@
 #include "ComputeSystemThumbnailResult.h"
 #include "ComputeSystemThumbnailResult.g.cpp"
 
+using namespace winrt::Windows::Storage::Streams;
+
 namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
 {
+    // The bytes are copied once, the array_view refers to the caller's memory which can go away once the
+    // constructor returns.
     ComputeSystemThumbnailResult::ComputeSystemThumbnailResult(array_view<uint8_t const> thumbnailInBytes) :
-        m_thumbnailInBytes(thumbnailInBytes), m_result(ProviderOperationStatus::Success, S_OK, hstring(), hstring())
+        m_thumbnail(CreateBuffer(thumbnailInBytes)), m_result(ProviderOperationStatus::Success, S_OK, hstring(), hstring())
+    {
+    }
+
+    ComputeSystemThumbnailResult::ComputeSystemThumbnailResult(IBuffer const& thumbnail) :
+        m_thumbnail(thumbnail ? thumbnail : CreateBuffer({})), m_result(ProviderOperationStatus::Success, S_OK, hstring(), hstring())
     {
     }
 
     ComputeSystemThumbnailResult::ComputeSystemThumbnailResult(winrt::hresult const& e, hstring const& displayMessage, hstring const& diagnosticText) :
-        m_thumbnailInBytes(array_view<uint8_t>{}), m_result(ProviderOperationStatus::Failure, e, displayMessage, diagnosticText)
+        m_thumbnail(CreateBuffer({})), m_result(ProviderOperationStatus::Failure, e, displayMessage, diagnosticText)
+    {
+    }
+
+    winrt::Microsoft::Windows::DevHome::SDK::ComputeSystemThumbnailResult ComputeSystemThumbnailResult::CreateFromBuffer(IBuffer const& thumbnail)
     {
+        return make<ComputeSystemThumbnailResult>(thumbnail);
     }
 
     com_array<uint8_t> ComputeSystemThumbnailResult::ThumbnailInBytes()
     {
-        return com_array<uint8_t>{ m_thumbnailInBytes.begin(), m_thumbnailInBytes.end() };
+        auto data = m_thumbnail.data();
+        return com_array<uint8_t>{ data, data + m_thumbnail.Length() };
+    }
+
+    IBuffer ComputeSystemThumbnailResult::Thumbnail()
+    {
+        return m_thumbnail;
     }
 
     ProviderOperationResult ComputeSystemThumbnailResult::Result()
     {
         return m_result;
     }
+
+    IBuffer ComputeSystemThumbnailResult::CreateBuffer(array_view<uint8_t const> bytes)
+    {
+        Buffer buffer{ bytes.size() };
+        if (bytes.size() > 0)
+        {
+            memcpy_s(buffer.data(), buffer.Capacity(), bytes.data(), bytes.size());
+        }
+
+        buffer.Length(bytes.size());
+        return buffer;
+    }
 }
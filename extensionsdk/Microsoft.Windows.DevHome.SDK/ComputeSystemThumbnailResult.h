@@ -6,12 +6,21 @@ namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
     struct ComputeSystemThumbnailResult : ComputeSystemThumbnailResultT<ComputeSystemThumbnailResult>
     {
         ComputeSystemThumbnailResult(array_view<uint8_t const> thumbnailInBytes);
+        ComputeSystemThumbnailResult(winrt::Windows::Storage::Streams::IBuffer const& thumbnail);
         ComputeSystemThumbnailResult(winrt::hresult const& e, hstring const& displayMessage, hstring const& diagnosticText);
+
+        static winrt::Microsoft::Windows::DevHome::SDK::ComputeSystemThumbnailResult CreateFromBuffer(winrt::Windows::Storage::Streams::IBuffer const& thumbnail);
+
         com_array<uint8_t> ThumbnailInBytes();
+        winrt::Windows::Storage::Streams::IBuffer Thumbnail();
         winrt::Microsoft::Windows::DevHome::SDK::ProviderOperationResult Result();
 
     private:
-        array_view<uint8_t const> m_thumbnailInBytes;
+        static winrt::Windows::Storage::Streams::IBuffer CreateBuffer(array_view<uint8_t const> bytes);
+
+        // Windows.Storage.Streams.Buffer is marshaled by value, so Dev Home can read the image without calling
+        // back into the extension.
+        winrt::Windows::Storage::Streams::IBuffer m_thumbnail;
         ProviderOperationResult m_result;
     };
 }
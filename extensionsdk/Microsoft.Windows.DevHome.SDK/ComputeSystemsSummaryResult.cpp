@@ -0,0 +1,34 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "ComputeSystemsSummaryResult.h"
+#include "ComputeSystemsSummaryResult.g.cpp"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    ComputeSystemsSummaryResult::ComputeSystemsSummaryResult(uint32_t computeSystemCount, uint32_t failedBatchCount) :
+        m_computeSystemCount(computeSystemCount), m_failedBatchCount(failedBatchCount), m_result(ProviderOperationStatus::Success, S_OK, hstring(), hstring())
+    {
+    }
+
+    ComputeSystemsSummaryResult::ComputeSystemsSummaryResult(winrt::hresult const& e, hstring const& displayMessage, hstring const& diagnosticText) :
+        m_computeSystemCount(0), m_failedBatchCount(0), m_result(ProviderOperationStatus::Failure, e, displayMessage, diagnosticText)
+    {
+    }
+
+    uint32_t ComputeSystemsSummaryResult::ComputeSystemCount()
+    {
+        return m_computeSystemCount;
+    }
+
+    uint32_t ComputeSystemsSummaryResult::FailedBatchCount()
+    {
+        return m_failedBatchCount;
+    }
+
+    ProviderOperationResult ComputeSystemsSummaryResult::Result()
+    {
+        return m_result;
+    }
+}
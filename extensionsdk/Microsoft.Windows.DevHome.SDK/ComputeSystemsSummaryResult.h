@@ -0,0 +1,29 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include "ComputeSystemsSummaryResult.g.h"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    struct ComputeSystemsSummaryResult : ComputeSystemsSummaryResultT<ComputeSystemsSummaryResult>
+    {
+        ComputeSystemsSummaryResult(uint32_t computeSystemCount, uint32_t failedBatchCount);
+        ComputeSystemsSummaryResult(winrt::hresult const& e, hstring const& displayMessage, hstring const& diagnosticText);
+        uint32_t ComputeSystemCount();
+        uint32_t FailedBatchCount();
+        ProviderOperationResult Result();
+
+    private:
+        uint32_t m_computeSystemCount;
+        uint32_t m_failedBatchCount;
+        ProviderOperationResult m_result;
+    };
+}
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::factory_implementation
+{
+    struct ComputeSystemsSummaryResult : ComputeSystemsSummaryResultT<ComputeSystemsSummaryResult, implementation::ComputeSystemsSummaryResult>
+    {
+    };
+}
@@ -0,0 +1,332 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "ConfigurationApplyScheduler.h"
+#include "ConfigurationApplyScheduler.g.cpp"
+#include "ConfigurationFileValidation.h"
+#include "ConfigurationUnitSchedule.h"
+#include "OperationTracker.h"
+
+namespace Projection = winrt::Microsoft::Windows::DevHome::SDK;
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    namespace
+    {
+        // Shared between ApplyAsync and the completion handlers of the units. The handlers only add their
+        // result, so that ApplyAsync reports every change in order from a single place.
+        struct ApplyState
+        {
+            explicit ApplyState(uint32_t unitCount) :
+                operations(unitCount)
+            {
+            }
+
+            OperationTracker operations;
+            std::mutex mutex;
+            std::vector<std::pair<uint32_t, Projection::ApplyConfigurationUnitResult>> completedUnits;
+        };
+
+        Projection::ApplyConfigurationUnitResult CreateUnitResult(
+            ConfigurationUnit const& unit,
+            ConfigurationUnitState state,
+            winrt::hresult const& e,
+            hstring const& description,
+            ConfigurationUnitResultSource source)
+        {
+            return Projection::ApplyConfigurationUnitResult(unit, state, false, false, Projection::ConfigurationUnitResultInformation(e, description, hstring(), source));
+        }
+
+        Projection::ApplyConfigurationUnitResult CreateFailureResult(ConfigurationUnit const& unit, winrt::hresult const& e, hstring const& description)
+        {
+            return CreateUnitResult(unit, ConfigurationUnitState::Completed, e, description, ConfigurationUnitResultSource::UnitProcessing);
+        }
+
+        Projection::ApplyConfigurationUnitResult GetUnitResult(IAsyncOperation<Projection::ApplyConfigurationUnitResult> const& operation, AsyncStatus status, ConfigurationUnit const& unit)
+        {
+            try
+            {
+                if (status == AsyncStatus::Canceled)
+                {
+                    return CreateFailureResult(unit, HRESULT_FROM_WIN32(ERROR_CANCELLED), L"The unit was cancelled.");
+                }
+
+                if (auto result = operation.GetResults())
+                {
+                    return result;
+                }
+
+                return CreateFailureResult(unit, E_UNEXPECTED, L"The unit was applied without a result.");
+            }
+            catch (hresult_error const& error)
+            {
+                return CreateFailureResult(unit, error.code(), error.message());
+            }
+        }
+
+        bool IsSuccessful(Projection::ApplyConfigurationUnitResult const& result)
+        {
+            auto resultInformation = result.ResultInformation();
+            return result.State() == ConfigurationUnitState::Completed && (!resultInformation || SUCCEEDED(resultInformation.ResultCode()));
+        }
+
+        void CompleteUnit(std::shared_ptr<ApplyState> const& state, uint32_t unitIndex, Projection::ApplyConfigurationUnitResult const& result)
+        {
+            {
+                std::lock_guard lock(state->mutex);
+                state->completedUnits.emplace_back(unitIndex, result);
+            }
+
+            state->operations.Complete(unitIndex);
+        }
+
+        // Completes the result stream however ApplyAsync ends.
+        struct CompleteStreamOnExit
+        {
+            Projection::ApplyConfigurationUnitResultStream stream;
+
+            ~CompleteStreamOnExit()
+            {
+                try
+                {
+                    if (stream)
+                    {
+                        stream.Complete();
+                    }
+                }
+                catch (...)
+                {
+                }
+            }
+        };
+
+        void StartUnit(std::shared_ptr<ApplyState> const& state, ConfigurationUnitApplyHandler const& applyUnit, ConfigurationUnit const& unit, uint32_t unitIndex)
+        {
+            try
+            {
+                auto operation = applyUnit(unit);
+                if (!operation)
+                {
+                    throw hresult_error(E_POINTER, L"The handler didn't return an operation.");
+                }
+
+                state->operations.Track(unitIndex, operation);
+                operation.Completed([state, unit, unitIndex](auto const& sender, AsyncStatus status) {
+                    CompleteUnit(state, unitIndex, GetUnitResult(sender, status, unit));
+                });
+            }
+            catch (hresult_error const& error)
+            {
+                CompleteUnit(state, unitIndex, CreateFailureResult(unit, error.code(), error.message()));
+            }
+        }
+    }
+
+    ConfigurationApplyScheduler::ConfigurationApplyScheduler(uint32_t maxConcurrentUnits) :
+        m_maxConcurrentUnits(maxConcurrentUnits)
+    {
+        if (maxConcurrentUnits == 0)
+        {
+            throw hresult_invalid_argument(L"maxConcurrentUnits parameter should be at least 1.");
+        }
+    }
+
+    ConfigurationApplyScheduler::ConfigurationApplyScheduler(uint32_t maxConcurrentUnits, ApplyConfigurationUnitResultStream const& resultStream) :
+        ConfigurationApplyScheduler(maxConcurrentUnits)
+    {
+        m_resultStream = resultStream;
+    }
+
+    uint32_t ConfigurationApplyScheduler::MaxConcurrentUnits()
+    {
+        return m_maxConcurrentUnits;
+    }
+
+    void ConfigurationApplyScheduler::AddUnit(ConfigurationUnit const& unit, array_view<hstring const> dependsOn)
+    {
+        if (!unit)
+        {
+            throw hresult_invalid_argument(L"unit parameter should not be null.");
+        }
+
+        std::lock_guard lock(m_mutex);
+        m_units.push_back(UnitEntry{ unit, std::vector<hstring>(dependsOn.begin(), dependsOn.end()) });
+    }
+
+    IAsyncOperationWithProgress<Projection::ApplyConfigurationSetResult, ConfigurationSetChangeData> ConfigurationApplyScheduler::ApplyAsync(
+        ConfigurationUnitApplyHandler applyUnit)
+    {
+        // Units added while the set is applied are only applied by the next call.
+        std::vector<ConfigurationUnit> units;
+        std::vector<std::vector<hstring>> dependsOn;
+        {
+            std::lock_guard lock(m_mutex);
+
+            // The first call completes the result stream, so a later call couldn't append to it.
+            if (m_resultStream && std::exchange(m_isApplied, true))
+            {
+                throw hresult_illegal_method_call(L"ApplyAsync can only be called once when the scheduler has a result stream.");
+            }
+
+            for (auto const& entry : m_units)
+            {
+                units.push_back(entry.unit);
+                dependsOn.push_back(entry.dependsOn);
+            }
+        }
+
+        auto strongThis = get_strong();
+        auto cancellation = co_await get_cancellation_token();
+        auto progress = co_await get_progress_token();
+        CompleteStreamOnExit completeStream{ m_resultStream };
+
+        if (!applyUnit)
+        {
+            throw hresult_invalid_argument(L"applyUnit parameter should not be null.");
+        }
+
+        std::vector<ConfigurationScheduledUnit> scheduledUnits;
+        scheduledUnits.reserve(units.size());
+        for (size_t i = 0; i < units.size(); i++)
+        {
+            scheduledUnits.push_back(ConfigurationScheduledUnit{
+                std::wstring{ units[i].Identifier() },
+                units[i].Intent() == ConfigurationUnitIntent::Assert,
+                std::vector<std::wstring>(dependsOn[i].begin(), dependsOn[i].end()) });
+        }
+
+        ConfigurationUnitSchedule schedule{ scheduledUnits };
+        if (auto const& error = schedule.Error())
+        {
+            throw hresult_invalid_argument(hstring{ *error });
+        }
+
+        auto unitCount = static_cast<uint32_t>(units.size());
+        auto state = std::make_shared<ApplyState>(unitCount);
+        cancellation.callback([state]() {
+            state->operations.CancelAll();
+        });
+
+        // Only ApplyAsync uses the schedule and the results, so they don't need the lock.
+        std::vector<Projection::ApplyConfigurationUnitResult> unitResults(unitCount, nullptr);
+        uint32_t activeUnitCount = 0;
+
+        progress(Projection::ConfigurationSetChangeData(ConfigurationSetChangeEventType::SetStateChanged, ConfigurationSetState::InProgress, ConfigurationUnitState::Unknown, nullptr, nullptr));
+
+        std::vector<Projection::ConfigurationSetChangeData> changesToReport;
+        auto reportUnitState = [&](uint32_t unitIndex, ConfigurationUnitState unitState, Projection::ConfigurationUnitResultInformation const& resultInformation) {
+            changesToReport.push_back(Projection::ConfigurationSetChangeData(
+                ConfigurationSetChangeEventType::UnitStateChanged,
+                ConfigurationSetState::InProgress,
+                unitState,
+                resultInformation,
+                units[unitIndex]));
+        };
+
+        auto reportUnitResult = [&](uint32_t unitIndex, Projection::ApplyConfigurationUnitResult const& result) {
+            unitResults[unitIndex] = result;
+            if (m_resultStream)
+            {
+                m_resultStream.Append(result);
+            }
+
+            reportUnitState(unitIndex, result.State(), result.ResultInformation());
+        };
+
+        std::vector<uint32_t> skippedUnits;
+        auto completeUnit = [&](uint32_t unitIndex, Projection::ApplyConfigurationUnitResult const& result) {
+            reportUnitResult(unitIndex, result);
+            skippedUnits.clear();
+            schedule.Complete(unitIndex, IsSuccessful(result), skippedUnits);
+
+            // Skipped units are reported as InProgress first, like every other unit, with the result code the
+            // configuration processor uses for them.
+            for (auto skippedUnit : skippedUnits)
+            {
+                reportUnitState(skippedUnit, ConfigurationUnitState::InProgress, nullptr);
+                reportUnitResult(skippedUnit, CreateUnitResult(
+                    units[skippedUnit],
+                    ConfigurationUnitState::Skipped,
+                    ConfigurationFileErrorCode::DependencyUnsatisfied,
+                    L"A unit that this unit depends on failed or was skipped.",
+                    ConfigurationUnitResultSource::Precondition));
+            }
+        };
+
+        while (true)
+        {
+            std::vector<std::pair<uint32_t, Projection::ApplyConfigurationUnitResult>> completedUnits;
+            auto isCanceled = state->operations.IsCanceled();
+            {
+                std::lock_guard lock(state->mutex);
+                completedUnits.swap(state->completedUnits);
+            }
+
+            for (auto const& [unitIndex, result] : completedUnits)
+            {
+                activeUnitCount--;
+                completeUnit(unitIndex, result);
+            }
+
+            std::vector<uint32_t> unitsToStart;
+            while (!isCanceled && activeUnitCount < m_maxConcurrentUnits)
+            {
+                auto unitIndex = schedule.TryStartNext();
+                if (!unitIndex)
+                {
+                    break;
+                }
+
+                unitsToStart.push_back(*unitIndex);
+                activeUnitCount++;
+                reportUnitState(*unitIndex, ConfigurationUnitState::InProgress, nullptr);
+            }
+
+            for (auto const& change : changesToReport)
+            {
+                progress(change);
+            }
+
+            changesToReport.clear();
+
+            // Units are started outside of the lock because a unit can complete synchronously.
+            for (auto unitIndex : unitsToStart)
+            {
+                StartUnit(state, applyUnit, units[unitIndex], unitIndex);
+            }
+
+            if (schedule.IsCompleted())
+            {
+                break;
+            }
+
+            // Throws when ApplyAsync is cancelled.
+            co_await state->operations.WaitForChange();
+        }
+
+        progress(Projection::ConfigurationSetChangeData(ConfigurationSetChangeEventType::SetStateChanged, ConfigurationSetState::Completed, ConfigurationUnitState::Unknown, nullptr, nullptr));
+
+        // Skipped units report the failure of another unit, so a unit that failed by itself is preferred.
+        winrt::hresult resultCode{ S_OK };
+        for (auto const& result : unitResults)
+        {
+            if (!IsSuccessful(result))
+            {
+                auto resultInformation = result.ResultInformation();
+                auto unitResultCode = resultInformation ? resultInformation.ResultCode() : winrt::hresult{ E_FAIL };
+                if (SUCCEEDED(resultCode) || result.State() != ConfigurationUnitState::Skipped)
+                {
+                    resultCode = unitResultCode;
+                }
+
+                if (result.State() != ConfigurationUnitState::Skipped)
+                {
+                    break;
+                }
+            }
+        }
+
+        co_return Projection::ApplyConfigurationSetResult(resultCode, winrt::single_threaded_vector(std::move(unitResults)).GetView());
+    }
+}
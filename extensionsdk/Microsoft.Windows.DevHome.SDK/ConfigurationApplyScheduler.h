@@ -0,0 +1,40 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include "ConfigurationApplyScheduler.g.h"
+
+using namespace winrt::Windows::Foundation;
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    struct ConfigurationApplyScheduler : ConfigurationApplySchedulerT<ConfigurationApplyScheduler>
+    {
+        ConfigurationApplyScheduler(uint32_t maxConcurrentUnits);
+        ConfigurationApplyScheduler(uint32_t maxConcurrentUnits, ApplyConfigurationUnitResultStream const& resultStream);
+
+        uint32_t MaxConcurrentUnits();
+        void AddUnit(ConfigurationUnit const& unit, array_view<hstring const> dependsOn);
+        IAsyncOperationWithProgress<winrt::Microsoft::Windows::DevHome::SDK::ApplyConfigurationSetResult, ConfigurationSetChangeData> ApplyAsync(
+            ConfigurationUnitApplyHandler applyUnit);
+
+    private:
+        struct UnitEntry
+        {
+            ConfigurationUnit unit;
+            std::vector<hstring> dependsOn;
+        };
+
+        uint32_t m_maxConcurrentUnits;
+        ApplyConfigurationUnitResultStream m_resultStream{ nullptr };
+        std::mutex m_mutex;
+        std::vector<UnitEntry> m_units;
+        bool m_isApplied{ false };
+    };
+}
+namespace winrt::Microsoft::Windows::DevHome::SDK::factory_implementation
+{
+    struct ConfigurationApplyScheduler : ConfigurationApplySchedulerT<ConfigurationApplyScheduler, implementation::ConfigurationApplyScheduler>
+    {
+    };
+}
@@ -0,0 +1,174 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "ConfigurationFileParseResult.h"
+#include "ConfigurationFileParseResult.g.cpp"
+#include "ConfigurationUnitSettings.h"
+
+using namespace winrt::Windows::Foundation::Collections;
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    namespace
+    {
+        ConfigurationUnitSettings::SettingValue ToSettingValue(ConfigurationYamlNode const& node, ConfigurationUnitSettings::KeyInterner& keys);
+
+        Projection::ConfigurationUnitSettings ToSettings(std::vector<ConfigurationUnitSettings::Setting>&& settings)
+        {
+            std::sort(settings.begin(), settings.end(), [](auto const& left, auto const& right) {
+                return left.first < right.first;
+            });
+
+            return make<ConfigurationUnitSettings>(std::move(settings));
+        }
+
+        // Mappings become nested settings. Sequences become nested settings keyed by the index of each item, with
+        // treatAsArray set to true, the form DSC resources expect arrays in.
+        Projection::ConfigurationUnitSettings ToSettings(ConfigurationYamlNode const& node, ConfigurationUnitSettings::KeyInterner& keys)
+        {
+            std::vector<ConfigurationUnitSettings::Setting> settings;
+            if (node.kind == ConfigurationYamlNode::Kind::Sequence)
+            {
+                settings.reserve(node.items.size() + 1);
+                for (size_t i = 0; i < node.items.size(); i++)
+                {
+                    settings.emplace_back(ConfigurationUnitSettings::InternKey(keys, to_hstring(i)), ToSettingValue(node.items[i], keys));
+                }
+
+                settings.emplace_back(ConfigurationUnitSettings::InternKey(keys, L"treatAsArray"), ConfigurationUnitSettings::SettingValue{ std::in_place_type<bool>, true });
+            }
+            else
+            {
+                settings.reserve(node.entries.size());
+                for (auto const& [key, value] : node.entries)
+                {
+                    settings.emplace_back(ConfigurationUnitSettings::InternKey(keys, hstring{ key }), ToSettingValue(value, keys));
+                }
+            }
+
+            return ToSettings(std::move(settings));
+        }
+
+        ConfigurationUnitSettings::SettingValue ToSettingValue(ConfigurationYamlNode const& node, ConfigurationUnitSettings::KeyInterner& keys)
+        {
+            using SettingValue = ConfigurationUnitSettings::SettingValue;
+            if (node.kind == ConfigurationYamlNode::Kind::Mapping || node.kind == ConfigurationYamlNode::Kind::Sequence)
+            {
+                return SettingValue{ std::in_place_type<Projection::ConfigurationUnitSettings>, ToSettings(node, keys) };
+            }
+
+            switch (node.GetScalarType())
+            {
+            case ConfigurationYamlNode::ScalarType::Boolean:
+                return SettingValue{ std::in_place_type<bool>, node.GetBoolean() };
+            case ConfigurationYamlNode::ScalarType::Integer:
+                return SettingValue{ std::in_place_type<int64_t>, node.GetInteger() };
+            case ConfigurationYamlNode::ScalarType::Float:
+                return SettingValue{ std::in_place_type<double>, node.GetFloat() };
+            case ConfigurationYamlNode::ScalarType::String:
+                return SettingValue{ std::in_place_type<hstring>, node.value };
+            default:
+                return SettingValue{ std::in_place_type<IInspectable>, nullptr };
+            }
+        }
+    }
+
+    ParsedConfigurationFile::ParsedConfigurationFile(ConfigurationFile const& file, hstring const& contentHash) :
+        status(ConfigurationFileParseStatus::Valid), configurationVersion(hstring{ file.ConfigurationVersion() }), contentHash(contentHash)
+    {
+        if (auto const& error = file.Error())
+        {
+            status = error->isUnsupported ? ConfigurationFileParseStatus::Unsupported : ConfigurationFileParseStatus::Invalid;
+            openResult = Projection::OpenConfigurationSetResult(
+                winrt::hresult{ error->resultCode }, hstring{ error->field }, hstring{ error->value }, error->line, error->column);
+            return;
+        }
+
+        openResult = Projection::OpenConfigurationSetResult(winrt::hresult{ S_OK }, hstring{}, hstring{}, 0, 0);
+        units.reserve(file.Units().size());
+
+        // Units of the same resource use the same keys, so the keys are shared by all the units of the file.
+        ConfigurationUnitSettings::KeyInterner keys;
+        for (auto const& unit : file.Units())
+        {
+            // Units without settings get empty settings, like a unit with an empty settings mapping. Settings are
+            // immutable, so the units of every result can share them.
+            auto& parsedUnit = units.emplace_back();
+            parsedUnit.resource = hstring{ unit.resource };
+            parsedUnit.identifier = hstring{ unit.identifier };
+            parsedUnit.isAssertion = unit.isAssertion;
+            parsedUnit.settings = ToSettings(unit.settings, keys);
+            for (auto const& identifier : unit.dependsOn)
+            {
+                parsedUnit.dependsOn.emplace_back(identifier);
+            }
+        }
+    }
+
+    ConfigurationFileParseResult::ConfigurationFileParseResult(std::shared_ptr<ParsedConfigurationFile const> const& file) :
+        m_file(file)
+    {
+        m_units.reserve(file->units.size());
+        for (auto const& unit : file->units)
+        {
+            m_units.push_back(Projection::ConfigurationUnit::CreateWithCompactSettings(
+                unit.resource,
+                unit.identifier,
+                ConfigurationUnitState::Unknown,
+                false,
+                single_threaded_vector<Projection::ConfigurationUnit>(),
+                unit.settings,
+                unit.isAssertion ? ConfigurationUnitIntent::Assert : ConfigurationUnitIntent::Apply));
+        }
+    }
+
+    ConfigurationFileParseStatus ConfigurationFileParseResult::Status()
+    {
+        return m_file->status;
+    }
+
+    OpenConfigurationSetResult ConfigurationFileParseResult::OpenResult()
+    {
+        return m_file->openResult;
+    }
+
+    hstring ConfigurationFileParseResult::ConfigurationVersion()
+    {
+        return m_file->configurationVersion;
+    }
+
+    hstring ConfigurationFileParseResult::ContentHash()
+    {
+        return m_file->contentHash;
+    }
+
+    com_array<ConfigurationUnit> ConfigurationFileParseResult::Units()
+    {
+        return com_array<ConfigurationUnit>(m_units.begin(), m_units.end());
+    }
+
+    com_array<hstring> ConfigurationFileParseResult::GetDependsOn(uint32_t unitIndex)
+    {
+        if (unitIndex >= m_units.size())
+        {
+            throw hresult_invalid_argument(L"unitIndex parameter should be less than the number of units.");
+        }
+
+        auto const& dependsOn = m_file->units[unitIndex].dependsOn;
+        return com_array<hstring>(dependsOn.begin(), dependsOn.end());
+    }
+
+    void ConfigurationFileParseResult::AddUnitsTo(ConfigurationApplyScheduler const& scheduler)
+    {
+        if (!scheduler)
+        {
+            throw hresult_invalid_argument(L"scheduler parameter should not be null.");
+        }
+
+        for (size_t i = 0; i < m_units.size(); i++)
+        {
+            scheduler.AddUnit(m_units[i], m_file->units[i].dependsOn);
+        }
+    }
+}
@@ -0,0 +1,55 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include "ConfigurationFileParseResult.g.h"
+#include "ConfigurationFileValidation.h"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    // What is kept of a parsed configuration file. It is immutable, so ConfigurationFileParser shares it between
+    // the results of the same content, while every result creates its own units.
+    struct ParsedConfigurationFile
+    {
+        struct Unit
+        {
+            hstring resource;
+            hstring identifier;
+            bool isAssertion;
+            winrt::Microsoft::Windows::DevHome::SDK::ConfigurationUnitSettings settings{ nullptr };
+            std::vector<hstring> dependsOn;
+        };
+
+        ParsedConfigurationFile(ConfigurationFile const& file, hstring const& contentHash);
+
+        ConfigurationFileParseStatus status;
+        OpenConfigurationSetResult openResult{ nullptr };
+        hstring configurationVersion;
+        hstring contentHash;
+        std::vector<Unit> units;
+    };
+
+    struct ConfigurationFileParseResult : ConfigurationFileParseResultT<ConfigurationFileParseResult>
+    {
+        ConfigurationFileParseResult(std::shared_ptr<ParsedConfigurationFile const> const& file);
+
+        ConfigurationFileParseStatus Status();
+        OpenConfigurationSetResult OpenResult();
+        hstring ConfigurationVersion();
+        hstring ContentHash();
+        com_array<ConfigurationUnit> Units();
+        com_array<hstring> GetDependsOn(uint32_t unitIndex);
+        void AddUnitsTo(ConfigurationApplyScheduler const& scheduler);
+
+    private:
+        // The result is immutable, so it doesn't need a lock.
+        std::shared_ptr<ParsedConfigurationFile const> m_file;
+        std::vector<ConfigurationUnit> m_units;
+    };
+}
+namespace winrt::Microsoft::Windows::DevHome::SDK::factory_implementation
+{
+    struct ConfigurationFileParseResult : ConfigurationFileParseResultT<ConfigurationFileParseResult, implementation::ConfigurationFileParseResult>
+    {
+    };
+}
@@ -0,0 +1,79 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "ConfigurationFileParser.h"
+#include "ConfigurationFileParser.g.cpp"
+#include "ConfigurationFileValidation.h"
+#include "Fnv1aHash.h"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    ConfigurationFileParser::ConfigurationFileParser(uint32_t cacheCapacity) :
+        m_cacheCapacity(cacheCapacity)
+    {
+    }
+
+    uint32_t ConfigurationFileParser::CacheCapacity()
+    {
+        return m_cacheCapacity;
+    }
+
+    winrt::Microsoft::Windows::DevHome::SDK::ConfigurationFileParseResult ConfigurationFileParser::Parse(hstring const& configuration)
+    {
+        Fnv1aHash contentHasher;
+        contentHasher.AddCodeUnits(configuration);
+        auto hash = contentHasher.Value();
+
+        // Every result creates its own units, outside the lock.
+        if (auto file = FindCachedFile(hash, configuration))
+        {
+            return make<ConfigurationFileParseResult>(file);
+        }
+
+        // Files are parsed outside the lock, so parsing a file doesn't block returning cached results.
+        auto file = std::make_shared<ParsedConfigurationFile const>(ConfigurationFile::Parse(configuration), hstring{ Fnv1aHash::ToHexString(hash) });
+        if (m_cacheCapacity != 0)
+        {
+            // Another thread may have parsed the same file in the meantime. Keep its file, so every result of a
+            // file that is cached shares the same settings.
+            std::lock_guard lock(m_mutex);
+            if (auto it = FindCacheEntry(hash, configuration); it != m_cache.end())
+            {
+                file = it->file;
+            }
+            else
+            {
+                if (m_cache.size() == m_cacheCapacity)
+                {
+                    m_cache.erase(m_cache.begin());
+                }
+
+                m_cache.push_back({ hash, configuration, file });
+            }
+        }
+
+        return make<ConfigurationFileParseResult>(file);
+    }
+
+    std::shared_ptr<ParsedConfigurationFile const> ConfigurationFileParser::FindCachedFile(uint64_t hash, hstring const& configuration)
+    {
+        std::lock_guard lock(m_mutex);
+        auto it = FindCacheEntry(hash, configuration);
+        if (it == m_cache.end())
+        {
+            return nullptr;
+        }
+
+        std::rotate(it, it + 1, m_cache.end());
+        return m_cache.back().file;
+    }
+
+    // The content is compared too, so a hash collision can't return the result of another file.
+    std::vector<ConfigurationFileParser::CacheEntry>::iterator ConfigurationFileParser::FindCacheEntry(uint64_t hash, hstring const& configuration)
+    {
+        return std::find_if(m_cache.begin(), m_cache.end(), [&](CacheEntry const& entry) {
+            return entry.hash == hash && entry.configuration == configuration;
+        });
+    }
+}
@@ -0,0 +1,43 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include "ConfigurationFileParser.g.h"
+#include "ConfigurationFileParseResult.h"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    struct ConfigurationFileParser : ConfigurationFileParserT<ConfigurationFileParser>
+    {
+        ConfigurationFileParser(uint32_t cacheCapacity);
+
+        uint32_t CacheCapacity();
+        winrt::Microsoft::Windows::DevHome::SDK::ConfigurationFileParseResult Parse(hstring const& configuration);
+
+    private:
+        struct CacheEntry
+        {
+            uint64_t hash;
+            hstring configuration;
+            std::shared_ptr<ParsedConfigurationFile const> file;
+        };
+
+        // FindCachedFile takes the lock and makes the entry the most recently used. FindCacheEntry must be called
+        // with the lock held.
+        std::shared_ptr<ParsedConfigurationFile const> FindCachedFile(uint64_t hash, hstring const& configuration);
+        std::vector<CacheEntry>::iterator FindCacheEntry(uint64_t hash, hstring const& configuration);
+
+        uint32_t m_cacheCapacity;
+        std::mutex m_mutex;
+
+        // Ordered from the least to the most recently used. Caches are expected to hold a few files, so looking
+        // up the hash in a vector is faster than maintaining a map next to the order.
+        std::vector<CacheEntry> m_cache;
+    };
+}
+namespace winrt::Microsoft::Windows::DevHome::SDK::factory_implementation
+{
+    struct ConfigurationFileParser : ConfigurationFileParserT<ConfigurationFileParser, implementation::ConfigurationFileParser>
+    {
+    };
+}
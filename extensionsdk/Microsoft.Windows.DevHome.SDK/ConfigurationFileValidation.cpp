@@ -0,0 +1,1096 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "ConfigurationFileValidation.h"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    namespace
+    {
+        using Node = ConfigurationYamlNode;
+
+        // Configuration files nest settings a few levels deep. The parser is recursive, so deeper files are
+        // reported as unsupported instead of overflowing the stack.
+        constexpr uint32_t MaxNestingDepth = 256;
+
+        struct ConfigurationFileException
+        {
+            ConfigurationFileError error;
+        };
+
+        [[noreturn]] void ThrowError(int32_t resultCode, std::wstring_view field, std::wstring_view value, uint32_t line, uint32_t column)
+        {
+            throw ConfigurationFileException{ ConfigurationFileError{ resultCode, std::wstring{ field }, std::wstring{ value }, line, column, false } };
+        }
+
+        [[noreturn]] void ThrowUnsupported(std::wstring_view value, uint32_t line, uint32_t column)
+        {
+            throw ConfigurationFileException{ ConfigurationFileError{ ConfigurationFileErrorCode::InvalidYaml, std::wstring{}, std::wstring{ value }, line, column, true } };
+        }
+
+        bool IsSpace(wchar_t character)
+        {
+            return character == L' ' || character == L'\t';
+        }
+
+        std::wstring_view TrimEnd(std::wstring_view text)
+        {
+            while (!text.empty() && IsSpace(text.back()))
+            {
+                text.remove_suffix(1);
+            }
+
+            return text;
+        }
+
+        size_t SkipSpaces(std::wstring_view text, size_t position)
+        {
+            while (position < text.size() && IsSpace(text[position]))
+            {
+                position++;
+            }
+
+            return position;
+        }
+
+        // Returns the position after the quoted scalar that starts at position, or npos if it isn't closed.
+        size_t SkipQuoted(std::wstring_view text, size_t position)
+        {
+            auto quote = text[position++];
+            while (position < text.size())
+            {
+                if (quote == L'"' && text[position] == L'\\')
+                {
+                    position += 2;
+                }
+                else if (text[position] == quote)
+                {
+                    // Single quotes are escaped by doubling them.
+                    if (quote == L'\'' && position + 1 < text.size() && text[position + 1] == L'\'')
+                    {
+                        position += 2;
+                    }
+                    else
+                    {
+                        return position + 1;
+                    }
+                }
+                else
+                {
+                    position++;
+                }
+            }
+
+            return std::wstring_view::npos;
+        }
+
+        struct Line
+        {
+            uint32_t number;
+
+            // The whole line, used by block scalars, which keep comments and spaces.
+            std::wstring_view text;
+
+            uint32_t indent;
+
+            // The line after its indentation, without comments and trailing spaces.
+            std::wstring_view content;
+        };
+
+        // Counts how deeply the node being parsed is nested while it is in scope.
+        class NestingScope
+        {
+        public:
+            NestingScope(uint32_t& depth, std::wstring_view value, uint32_t line, uint32_t column) :
+                m_depth(depth)
+            {
+                if (m_depth == MaxNestingDepth)
+                {
+                    ThrowUnsupported(value, line, column);
+                }
+
+                m_depth++;
+            }
+
+            ~NestingScope()
+            {
+                m_depth--;
+            }
+
+            NestingScope(NestingScope const&) = delete;
+            NestingScope& operator=(NestingScope const&) = delete;
+
+        private:
+            uint32_t& m_depth;
+        };
+
+        class YamlParser
+        {
+        public:
+            YamlParser(std::wstring_view text)
+            {
+                SplitLines(text);
+            }
+
+            Node ParseDocument()
+            {
+                auto root = ParseBlock(-1);
+                SkipBlankLines();
+                if (m_index < m_lines.size())
+                {
+                    auto const& line = m_lines[m_index];
+                    ThrowError(ConfigurationFileErrorCode::InvalidYaml, {}, line.content, line.number, line.indent + 1);
+                }
+
+                return root;
+            }
+
+        private:
+            void SplitLines(std::wstring_view text)
+            {
+                if (!text.empty() && text.front() == L'\xFEFF')
+                {
+                    text.remove_prefix(1);
+                }
+
+                uint32_t number = 0;
+                bool hasContent = false;
+                while (!text.empty())
+                {
+                    auto end = text.find(L'\n');
+                    auto lineText = text.substr(0, end);
+                    text.remove_prefix(end == std::wstring_view::npos ? text.size() : end + 1);
+                    if (!lineText.empty() && lineText.back() == L'\r')
+                    {
+                        lineText.remove_suffix(1);
+                    }
+
+                    Line line{ ++number, lineText, 0, {} };
+                    while (line.indent < lineText.size() && lineText[line.indent] == L' ')
+                    {
+                        line.indent++;
+                    }
+
+                    line.content = StripComment(lineText.substr(line.indent));
+                    if (line.content.empty())
+                    {
+                        m_lines.push_back(line);
+                        continue;
+                    }
+
+                    if (line.content.front() == L'\t')
+                    {
+                        ThrowError(ConfigurationFileErrorCode::InvalidYaml, {}, L"\t", line.number, line.indent + 1);
+                    }
+
+                    if (line.indent == 0 && line.content.front() == L'%')
+                    {
+                        if (hasContent)
+                        {
+                            ThrowError(ConfigurationFileErrorCode::InvalidYaml, {}, line.content, line.number, 1);
+                        }
+
+                        continue;
+                    }
+
+                    if (line.indent == 0 && (line.content == L"---" || line.content.substr(0, 4) == L"--- "))
+                    {
+                        if (hasContent)
+                        {
+                            ThrowUnsupported(line.content, line.number, 1);
+                        }
+
+                        // Content after the marker belongs to the document, e.g. "--- !tag" or "--- value".
+                        auto rest = line.content.substr(3);
+                        auto position = SkipSpaces(rest, 0);
+                        if (position == rest.size())
+                        {
+                            continue;
+                        }
+
+                        line.indent += static_cast<uint32_t>(3 + position);
+                        line.content = rest.substr(position);
+                    }
+
+                    if (line.indent == 0 && line.content == L"...")
+                    {
+                        break;
+                    }
+
+                    hasContent = true;
+                    m_lines.push_back(line);
+                }
+            }
+
+            static std::wstring_view StripComment(std::wstring_view text)
+            {
+                size_t position = 0;
+                while (position < text.size())
+                {
+                    auto character = text[position];
+                    if ((character == L'"' || character == L'\'') && (position == 0 || !IsPlainCharacter(text[position - 1])))
+                    {
+                        auto end = SkipQuoted(text, position);
+                        if (end == std::wstring_view::npos)
+                        {
+                            break;
+                        }
+
+                        position = end;
+                    }
+                    else if (character == L'#' && (position == 0 || IsSpace(text[position - 1])))
+                    {
+                        return TrimEnd(text.substr(0, position));
+                    }
+                    else
+                    {
+                        position++;
+                    }
+                }
+
+                return TrimEnd(text);
+            }
+
+            // Quotes only start a quoted scalar at the start of a value, not inside plain text like "it's".
+            static bool IsPlainCharacter(wchar_t character)
+            {
+                return !IsSpace(character) && character != L'[' && character != L'{' && character != L',' && character != L':' && character != L'-';
+            }
+
+            static bool IsSequenceItem(std::wstring_view content)
+            {
+                return content == L"-" || (content.size() > 1 && content[0] == L'-' && IsSpace(content[1]));
+            }
+
+            // Returns the position of the colon that ends the key of a mapping entry, or npos.
+            static size_t FindMappingColon(std::wstring_view content)
+            {
+                size_t position = 0;
+                if (content.front() == L'"' || content.front() == L'\'')
+                {
+                    position = SkipQuoted(content, 0);
+                    if (position == std::wstring_view::npos)
+                    {
+                        return std::wstring_view::npos;
+                    }
+                }
+                else if (content.front() == L'[' || content.front() == L'{')
+                {
+                    return std::wstring_view::npos;
+                }
+
+                for (; position < content.size(); position++)
+                {
+                    if (content[position] == L':' && (position + 1 == content.size() || IsSpace(content[position + 1])))
+                    {
+                        return position;
+                    }
+                }
+
+                return std::wstring_view::npos;
+            }
+
+            void SkipBlankLines()
+            {
+                while (m_index < m_lines.size() && m_lines[m_index].content.empty())
+                {
+                    m_index++;
+                }
+            }
+
+            // Parses the node in the lines that are indented more than parentIndent. Returns a null node if there
+            // are none.
+            Node ParseBlock(int64_t parentIndent, uint32_t line = 0, uint32_t column = 0)
+            {
+                SkipBlankLines();
+                if (m_index == m_lines.size() || m_lines[m_index].indent <= parentIndent)
+                {
+                    Node node;
+                    node.line = line;
+                    node.column = column;
+                    return node;
+                }
+
+                return ParseNode();
+            }
+
+            Node ParseNode()
+            {
+                auto const& line = m_lines[m_index];
+                NestingScope nesting{ m_depth, line.content, line.number, line.indent + 1 };
+                if (IsSequenceItem(line.content))
+                {
+                    return ParseSequence(line.indent);
+                }
+
+                if (FindMappingColon(line.content) != std::wstring_view::npos)
+                {
+                    return ParseMapping(line.indent);
+                }
+
+                auto indent = line.indent;
+                auto node = ParseInline(line.content, line.number, line.indent + 1);
+                m_index++;
+                ParseContinuationLines(node, indent);
+                return node;
+            }
+
+            Node ParseSequence(uint32_t indent)
+            {
+                Node node;
+                node.kind = Node::Kind::Sequence;
+                node.line = m_lines[m_index].number;
+                node.column = indent + 1;
+                while (true)
+                {
+                    SkipBlankLines();
+                    if (m_index == m_lines.size() || m_lines[m_index].indent < indent)
+                    {
+                        break;
+                    }
+
+                    // A line at the same indentation that isn't an item ends a sequence that is indented like the
+                    // key it belongs to, e.g. the next key of "resources:" in a unit. The caller decides whether
+                    // the line is valid.
+                    auto& line = m_lines[m_index];
+                    if (line.indent == indent && !IsSequenceItem(line.content))
+                    {
+                        break;
+                    }
+
+                    if (line.indent > indent)
+                    {
+                        ThrowError(ConfigurationFileErrorCode::InvalidYaml, {}, line.content, line.number, line.indent + 1);
+                    }
+
+                    auto position = SkipSpaces(line.content, 1);
+                    if (position == line.content.size())
+                    {
+                        auto number = line.number;
+                        m_index++;
+                        node.items.push_back(ParseBlock(indent, number, indent + 1));
+                        continue;
+                    }
+
+                    // The item starts on the same line, e.g. "- resource: ...". The rest of the line is parsed
+                    // as if it was a line of its own, indented to where the item starts.
+                    line.indent += static_cast<uint32_t>(position);
+                    line.content.remove_prefix(position);
+                    node.items.push_back(ParseNode());
+                }
+
+                return node;
+            }
+
+            Node ParseMapping(uint32_t indent)
+            {
+                Node node;
+                node.kind = Node::Kind::Mapping;
+                node.line = m_lines[m_index].number;
+                node.column = indent + 1;
+                while (true)
+                {
+                    SkipBlankLines();
+                    if (m_index == m_lines.size() || m_lines[m_index].indent < indent)
+                    {
+                        break;
+                    }
+
+                    auto const line = m_lines[m_index];
+                    auto colon = (line.indent == indent) ? FindMappingColon(line.content) : std::wstring_view::npos;
+                    if (colon == std::wstring_view::npos)
+                    {
+                        ThrowError(ConfigurationFileErrorCode::InvalidYaml, {}, line.content, line.number, line.indent + 1);
+                    }
+
+                    auto keyText = TrimEnd(line.content.substr(0, colon));
+                    if (keyText.front() == L'?' || keyText.front() == L'&' || keyText.front() == L'*' || keyText.front() == L'!')
+                    {
+                        ThrowUnsupported(keyText, line.number, line.indent + 1);
+                    }
+
+                    auto keyNode = ParseInline(keyText, line.number, line.indent + 1);
+                    if (keyNode.kind != Node::Kind::Scalar)
+                    {
+                        ThrowUnsupported(keyText, line.number, line.indent + 1);
+                    }
+
+                    if (node.Find(keyNode.value))
+                    {
+                        ThrowError(ConfigurationFileErrorCode::InvalidYaml, keyNode.value, {}, line.number, line.indent + 1);
+                    }
+
+                    auto valuePosition = SkipSpaces(line.content, colon + 1);
+                    auto valueText = line.content.substr(valuePosition);
+                    auto valueColumn = static_cast<uint32_t>(line.indent + valuePosition + 1);
+                    m_index++;
+
+                    Node value;
+                    if (valueText.empty())
+                    {
+                        SkipBlankLines();
+                        if (m_index < m_lines.size() && m_lines[m_index].indent == indent && IsSequenceItem(m_lines[m_index].content))
+                        {
+                            // Sequences can be at the same indentation as their key.
+                            value = ParseSequence(indent);
+                        }
+                        else
+                        {
+                            value = ParseBlock(indent, line.number, valueColumn);
+                        }
+                    }
+                    else if (valueText.front() == L'|' || valueText.front() == L'>')
+                    {
+                        value = ParseBlockScalar(valueText, indent, line.number, valueColumn);
+                    }
+                    else
+                    {
+                        value = ParseInline(valueText, line.number, valueColumn);
+                        ParseContinuationLines(value, indent);
+                    }
+
+                    node.entries.emplace_back(std::move(keyNode.value), std::move(value));
+                }
+
+                return node;
+            }
+
+            // Plain scalars can continue on the following lines when they are indented more than their parent.
+            void ParseContinuationLines(Node& node, uint32_t parentIndent)
+            {
+                while (true)
+                {
+                    SkipBlankLines();
+                    if (m_index == m_lines.size() || m_lines[m_index].indent <= parentIndent)
+                    {
+                        return;
+                    }
+
+                    auto const& line = m_lines[m_index];
+                    if (node.kind != Node::Kind::Scalar || node.isQuoted || FindMappingColon(line.content) != std::wstring_view::npos)
+                    {
+                        ThrowError(ConfigurationFileErrorCode::InvalidYaml, {}, line.content, line.number, line.indent + 1);
+                    }
+
+                    node.value += L' ';
+                    node.value += line.content;
+                    m_index++;
+                }
+            }
+
+            Node ParseBlockScalar(std::wstring_view header, uint32_t parentIndent, uint32_t lineNumber, uint32_t column)
+            {
+                auto isFolded = header.front() == L'>';
+                wchar_t chomping = L' ';
+                for (auto character : header.substr(1))
+                {
+                    if (character == L'-' || character == L'+')
+                    {
+                        chomping = character;
+                    }
+                    else if (character < L'1' || character > L'9')
+                    {
+                        ThrowError(ConfigurationFileErrorCode::InvalidYaml, {}, header, lineNumber, column);
+                    }
+                }
+
+                Node node;
+                node.kind = Node::Kind::Scalar;
+                node.isQuoted = true;
+                node.line = lineNumber;
+                node.column = column;
+
+                // The indentation of the first line that isn't blank is the indentation of the whole scalar.
+                std::optional<uint32_t> contentIndent;
+                size_t trailingNewLines = 0;
+                while (m_index < m_lines.size())
+                {
+                    auto const& line = m_lines[m_index];
+                    auto isBlank = line.text.find_first_not_of(L' ') == std::wstring_view::npos;
+                    if (!isBlank && line.indent <= parentIndent)
+                    {
+                        break;
+                    }
+
+                    if (isBlank)
+                    {
+                        trailingNewLines++;
+                    }
+                    else
+                    {
+                        if (!contentIndent)
+                        {
+                            contentIndent = line.indent;
+                        }
+                        else if (line.indent < *contentIndent)
+                        {
+                            ThrowError(ConfigurationFileErrorCode::InvalidYaml, {}, line.content, line.number, line.indent + 1);
+                        }
+
+                        if (!node.value.empty() || trailingNewLines > 0)
+                        {
+                            auto isMoreIndented = line.indent > *contentIndent;
+                            if (isFolded && trailingNewLines == 0 && !isMoreIndented)
+                            {
+                                node.value += L' ';
+                            }
+                            else
+                            {
+                                node.value.append(isFolded ? trailingNewLines : trailingNewLines + 1, L'\n');
+                            }
+                        }
+
+                        node.value += line.text.substr(*contentIndent);
+                        trailingNewLines = 0;
+                    }
+
+                    m_index++;
+                }
+
+                if (!node.value.empty() && chomping != L'-')
+                {
+                    node.value.append(chomping == L'+' ? trailingNewLines + 1 : 1, L'\n');
+                }
+
+                return node;
+            }
+
+            // Parses a node that is entirely on one line: a flow collection or a scalar.
+            Node ParseInline(std::wstring_view text, uint32_t lineNumber, uint32_t column)
+            {
+                size_t position = 0;
+                auto node = ParseFlowNode(text, position, lineNumber, column, false);
+                position = SkipSpaces(text, position);
+                if (position != text.size())
+                {
+                    ThrowError(ConfigurationFileErrorCode::InvalidYaml, {}, text.substr(position), lineNumber, static_cast<uint32_t>(column + position));
+                }
+
+                return node;
+            }
+
+            Node ParseFlowNode(std::wstring_view text, size_t& position, uint32_t lineNumber, uint32_t column, bool isInFlow)
+            {
+                position = SkipSpaces(text, position);
+                Node node;
+                node.line = lineNumber;
+                node.column = static_cast<uint32_t>(column + position);
+                if (position == text.size())
+                {
+                    return node;
+                }
+
+                auto character = text[position];
+                if (character == L'&' || character == L'*' || character == L'!')
+                {
+                    ThrowUnsupported(text.substr(position), lineNumber, node.column);
+                }
+
+                if (character == L'[' || character == L'{')
+                {
+                    NestingScope nesting{ m_depth, text.substr(position), lineNumber, node.column };
+                    auto isSequence = character == L'[';
+                    auto closing = isSequence ? L']' : L'}';
+                    node.kind = isSequence ? Node::Kind::Sequence : Node::Kind::Mapping;
+                    position = SkipSpaces(text, position + 1);
+                    while (position < text.size() && text[position] != closing)
+                    {
+                        auto item = ParseFlowNode(text, position, lineNumber, column, true);
+                        position = SkipSpaces(text, position);
+                        if (!isSequence)
+                        {
+                            if (position == text.size() || text[position] != L':' || item.kind != Node::Kind::Scalar)
+                            {
+                                ThrowError(ConfigurationFileErrorCode::InvalidYaml, {}, text.substr(position), lineNumber, static_cast<uint32_t>(column + position));
+                            }
+
+                            if (node.Find(item.value))
+                            {
+                                ThrowError(ConfigurationFileErrorCode::InvalidYaml, item.value, {}, lineNumber, item.column);
+                            }
+
+                            position++;
+                            auto value = ParseFlowNode(text, position, lineNumber, column, true);
+                            node.entries.emplace_back(std::move(item.value), std::move(value));
+                            position = SkipSpaces(text, position);
+                        }
+                        else
+                        {
+                            node.items.push_back(std::move(item));
+                        }
+
+                        if (position < text.size() && text[position] == L',')
+                        {
+                            position = SkipSpaces(text, position + 1);
+                        }
+                        else if (position < text.size() && text[position] != closing)
+                        {
+                            ThrowError(ConfigurationFileErrorCode::InvalidYaml, {}, text.substr(position), lineNumber, static_cast<uint32_t>(column + position));
+                        }
+                    }
+
+                    if (position == text.size())
+                    {
+                        // Flow collections that span lines aren't used by configuration files.
+                        ThrowUnsupported(text, lineNumber, node.column);
+                    }
+
+                    position++;
+                    return node;
+                }
+
+                node.kind = Node::Kind::Scalar;
+                if (character == L'"' || character == L'\'')
+                {
+                    auto end = SkipQuoted(text, position);
+                    if (end == std::wstring_view::npos)
+                    {
+                        ThrowUnsupported(text.substr(position), lineNumber, node.column);
+                    }
+
+                    node.isQuoted = true;
+                    node.value = Unquote(text.substr(position, end - position), lineNumber, node.column);
+                    position = end;
+                    return node;
+                }
+
+                // Plain scalars end at the end of the line, or in flow collections at a separator.
+                auto start = position;
+                while (position < text.size())
+                {
+                    auto current = text[position];
+                    if (isInFlow && (current == L',' || current == L']' || current == L'}' ||
+                        (current == L':' && (position + 1 == text.size() || IsSpace(text[position + 1]) || text[position + 1] == L','))))
+                    {
+                        break;
+                    }
+
+                    if (!isInFlow && current == L':' && (position + 1 == text.size() || IsSpace(text[position + 1])))
+                    {
+                        // A mapping can't start in the middle of a line.
+                        ThrowError(ConfigurationFileErrorCode::InvalidYaml, {}, text.substr(start), lineNumber, node.column);
+                    }
+
+                    position++;
+                }
+
+                node.value = TrimEnd(text.substr(start, position - start));
+                return node;
+            }
+
+            static std::wstring Unquote(std::wstring_view text, uint32_t lineNumber, uint32_t column)
+            {
+                std::wstring value;
+                auto quote = text.front();
+                auto content = text.substr(1, text.size() - 2);
+                for (size_t i = 0; i < content.size(); i++)
+                {
+                    if (quote == L'\'')
+                    {
+                        value += content[i];
+                        if (content[i] == L'\'')
+                        {
+                            i++;
+                        }
+
+                        continue;
+                    }
+
+                    if (content[i] != L'\\')
+                    {
+                        value += content[i];
+                        continue;
+                    }
+
+                    auto escape = content[++i];
+                    switch (escape)
+                    {
+                    case L'0': value += L'\0'; break;
+                    case L'a': value += L'\a'; break;
+                    case L'b': value += L'\b'; break;
+                    case L't': value += L'\t'; break;
+                    case L'n': value += L'\n'; break;
+                    case L'v': value += L'\v'; break;
+                    case L'f': value += L'\f'; break;
+                    case L'r': value += L'\r'; break;
+                    case L'e': value += L'\x1B'; break;
+                    case L' ': value += L' '; break;
+                    case L'"': value += L'"'; break;
+                    case L'/': value += L'/'; break;
+                    case L'\\': value += L'\\'; break;
+                    case L'x':
+                    case L'u':
+                    {
+                        size_t digitCount = (escape == L'x') ? 2 : 4;
+                        auto digits = content.substr(i + 1, digitCount);
+                        wchar_t codeUnit = 0;
+                        for (auto digit : digits)
+                        {
+                            if (!std::iswxdigit(digit))
+                            {
+                                ThrowError(ConfigurationFileErrorCode::InvalidYaml, {}, text, lineNumber, column);
+                            }
+
+                            codeUnit = static_cast<wchar_t>(codeUnit * 16 + (std::iswdigit(digit) ? digit - L'0' : (std::towlower(digit) - L'a' + 10)));
+                        }
+
+                        if (digits.size() != digitCount)
+                        {
+                            ThrowError(ConfigurationFileErrorCode::InvalidYaml, {}, text, lineNumber, column);
+                        }
+
+                        value += codeUnit;
+                        i += digitCount;
+                        break;
+                    }
+                    default:
+                        ThrowError(ConfigurationFileErrorCode::InvalidYaml, {}, text, lineNumber, column);
+                    }
+                }
+
+                return value;
+            }
+
+            std::vector<Line> m_lines;
+            size_t m_index{ 0 };
+
+            // How deeply the node being parsed is nested.
+            uint32_t m_depth{ 0 };
+        };
+
+        std::wstring_view GetKindName(Node::Kind kind)
+        {
+            switch (kind)
+            {
+            case Node::Kind::Scalar:
+                return L"scalar";
+            case Node::Kind::Mapping:
+                return L"mapping";
+            case Node::Kind::Sequence:
+                return L"sequence";
+            default:
+                return L"null";
+            }
+        }
+
+        void CheckKind(Node const& node, Node::Kind kind, std::wstring_view field)
+        {
+            if (node.kind != kind)
+            {
+                ThrowError(ConfigurationFileErrorCode::InvalidFieldType, field, GetKindName(node.kind), node.line, node.column);
+            }
+        }
+
+        Node const& GetRequiredField(Node const& mapping, std::wstring_view field, Node::Kind kind)
+        {
+            auto node = mapping.Find(field);
+            if (!node || node->kind == Node::Kind::Null)
+            {
+                ThrowError(ConfigurationFileErrorCode::MissingField, field, {}, mapping.line, mapping.column);
+            }
+
+            CheckKind(*node, kind, field);
+            return *node;
+        }
+
+        // Versions are "major.minor" or "major.minor.patch". Returns the minor version of 0.x versions.
+        std::optional<uint32_t> GetMinorVersion(std::wstring_view version)
+        {
+            if (version.substr(0, 2) != L"0.")
+            {
+                return std::nullopt;
+            }
+
+            uint32_t minor = 0;
+            size_t position = 2;
+            while (position < version.size() && std::iswdigit(version[position]))
+            {
+                minor = minor * 10 + (version[position++] - L'0');
+            }
+
+            if (position == 2 || (position < version.size() && version[position] != L'.'))
+            {
+                return std::nullopt;
+            }
+
+            return minor;
+        }
+    }
+
+    ConfigurationYamlNode const* ConfigurationYamlNode::Find(std::wstring_view key) const
+    {
+        auto it = std::find_if(entries.begin(), entries.end(), [key](auto const& entry) {
+            return entry.first == key;
+        });
+
+        return (it != entries.end()) ? &it->second : nullptr;
+    }
+
+    ConfigurationYamlNode::ScalarType ConfigurationYamlNode::GetScalarType() const
+    {
+        if (kind == Kind::Null)
+        {
+            return ScalarType::Null;
+        }
+
+        if (isQuoted)
+        {
+            return ScalarType::String;
+        }
+
+        if (value.empty() || value == L"~" || value == L"null" || value == L"Null" || value == L"NULL")
+        {
+            return ScalarType::Null;
+        }
+
+        if (value == L"true" || value == L"True" || value == L"TRUE" || value == L"false" || value == L"False" || value == L"FALSE")
+        {
+            return ScalarType::Boolean;
+        }
+
+        wchar_t* end = nullptr;
+        errno = 0;
+        std::wcstoll(value.c_str(), &end, (value.size() > 2 && value[0] == L'0' && (value[1] == L'x' || value[1] == L'X')) ? 16 : 10);
+        if (*end == L'\0' && errno == 0 && (std::iswdigit(value.front()) || value.size() > 1))
+        {
+            return ScalarType::Integer;
+        }
+
+        static constexpr std::wstring_view SpecialFloats[]{ L".inf", L"+.inf", L"-.inf", L".Inf", L"+.Inf", L"-.Inf", L".nan", L".NaN" };
+        if (std::find(std::begin(SpecialFloats), std::end(SpecialFloats), value) != std::end(SpecialFloats))
+        {
+            return ScalarType::Float;
+        }
+
+        // wcstod also accepts forms that YAML doesn't, like "inf" and hexadecimal floats.
+        auto isNumeric = std::all_of(value.begin(), value.end(), [](wchar_t character) {
+            return std::iswdigit(character) || character == L'.' || character == L'e' || character == L'E' || character == L'+' || character == L'-';
+        });
+
+        std::wcstod(value.c_str(), &end);
+        return (isNumeric && *end == L'\0') ? ScalarType::Float : ScalarType::String;
+    }
+
+    bool ConfigurationYamlNode::GetBoolean() const
+    {
+        return value.front() == L't' || value.front() == L'T';
+    }
+
+    int64_t ConfigurationYamlNode::GetInteger() const
+    {
+        auto isHexadecimal = value.size() > 2 && value[0] == L'0' && (value[1] == L'x' || value[1] == L'X');
+        return std::wcstoll(value.c_str(), nullptr, isHexadecimal ? 16 : 10);
+    }
+
+    double ConfigurationYamlNode::GetFloat() const
+    {
+        auto text = std::wstring_view{ value };
+        auto isNegative = text.front() == L'-';
+        if (text.back() == L'f' || text.back() == L'F')
+        {
+            return isNegative ? -std::numeric_limits<double>::infinity() : std::numeric_limits<double>::infinity();
+        }
+
+        if (text.back() == L'n' || text.back() == L'N')
+        {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+
+        return std::wcstod(value.c_str(), nullptr);
+    }
+
+    ConfigurationFile ConfigurationFile::Parse(std::wstring_view text)
+    {
+        ConfigurationFile file;
+        try
+        {
+            auto root = YamlParser{ text }.ParseDocument();
+            file.Validate(root);
+        }
+        catch (ConfigurationFileException& exception)
+        {
+            file.m_error = std::move(exception.error);
+            file.m_configurationVersion.clear();
+            file.m_units.clear();
+        }
+
+        file.m_unitNodes.clear();
+        return file;
+    }
+
+    std::optional<ConfigurationFileError> const& ConfigurationFile::Error() const
+    {
+        return m_error;
+    }
+
+    std::wstring const& ConfigurationFile::ConfigurationVersion() const
+    {
+        return m_configurationVersion;
+    }
+
+    std::vector<ConfigurationFileUnit> const& ConfigurationFile::Units() const
+    {
+        return m_units;
+    }
+
+    void ConfigurationFile::Validate(ConfigurationYamlNode const& root)
+    {
+        if (root.kind != Node::Kind::Mapping)
+        {
+            ThrowError(ConfigurationFileErrorCode::InvalidConfigurationFile, {}, {}, root.line, root.column);
+        }
+
+        // Newer versions of the format describe themselves with a schema instead of properties.
+        if (!root.Find(L"properties") && root.Find(L"$schema"))
+        {
+            auto schema = root.Find(L"$schema");
+            ThrowUnsupported(schema->value, schema->line, schema->column);
+        }
+
+        auto const& properties = GetRequiredField(root, L"properties", Node::Kind::Mapping);
+        auto const& version = GetRequiredField(properties, L"configurationVersion", Node::Kind::Scalar);
+        auto minorVersion = GetMinorVersion(version.value);
+        if (!minorVersion || *minorVersion < 1 || *minorVersion > 2)
+        {
+            ThrowError(ConfigurationFileErrorCode::UnknownConfigurationFileVersion, L"configurationVersion", version.value, version.line, version.column);
+        }
+
+        m_configurationVersion = version.value;
+        AddUnits(properties, L"assertions", true);
+        AddUnits(properties, L"resources", false);
+        ValidateDependencies();
+    }
+
+    void ConfigurationFile::AddUnits(ConfigurationYamlNode const& properties, std::wstring_view field, bool isAssertion)
+    {
+        auto units = properties.Find(field);
+        if (!units || units->kind == Node::Kind::Null)
+        {
+            return;
+        }
+
+        CheckKind(*units, Node::Kind::Sequence, field);
+        for (auto const& unitNode : units->items)
+        {
+            CheckKind(unitNode, Node::Kind::Mapping, field);
+
+            ConfigurationFileUnit unit{};
+            unit.isAssertion = isAssertion;
+
+            auto const& resource = GetRequiredField(unitNode, L"resource", Node::Kind::Scalar);
+            auto separator = resource.value.find(L'/');
+            if (resource.value.empty() || resource.value.find(L'/', separator == std::wstring::npos ? separator : separator + 1) != std::wstring::npos ||
+                separator == 0 || separator + 1 == resource.value.size())
+            {
+                ThrowError(ConfigurationFileErrorCode::InvalidFieldValue, L"resource", resource.value, resource.line, resource.column);
+            }
+
+            unit.resource = resource.value;
+
+            if (auto identifier = unitNode.Find(L"id"); identifier && identifier->kind != Node::Kind::Null)
+            {
+                CheckKind(*identifier, Node::Kind::Scalar, L"id");
+                unit.identifier = identifier->value;
+            }
+
+            if (auto dependsOn = unitNode.Find(L"dependsOn"); dependsOn && dependsOn->kind != Node::Kind::Null)
+            {
+                CheckKind(*dependsOn, Node::Kind::Sequence, L"dependsOn");
+                for (auto const& dependency : dependsOn->items)
+                {
+                    CheckKind(dependency, Node::Kind::Scalar, L"dependsOn");
+                    unit.dependsOn.push_back(dependency.value);
+                }
+            }
+
+            if (auto directives = unitNode.Find(L"directives"); directives && directives->kind != Node::Kind::Null)
+            {
+                CheckKind(*directives, Node::Kind::Mapping, L"directives");
+            }
+
+            if (auto settings = unitNode.Find(L"settings"); settings && settings->kind != Node::Kind::Null)
+            {
+                CheckKind(*settings, Node::Kind::Mapping, L"settings");
+                unit.settings = *settings;
+            }
+
+            m_units.push_back(std::move(unit));
+            m_unitNodes.push_back(&unitNode);
+        }
+    }
+
+    void ConfigurationFile::ValidateDependencies()
+    {
+        std::unordered_map<std::wstring_view, size_t> unitsByIdentifier;
+        for (size_t i = 0; i < m_units.size(); i++)
+        {
+            auto const& identifier = m_units[i].identifier;
+            if (!identifier.empty() && !unitsByIdentifier.emplace(identifier, i).second)
+            {
+                auto const& node = *m_unitNodes[i]->Find(L"id");
+                ThrowError(ConfigurationFileErrorCode::DuplicateIdentifier, L"id", identifier, node.line, node.column);
+            }
+        }
+
+        std::vector<std::vector<size_t>> dependencies(m_units.size());
+        for (size_t i = 0; i < m_units.size(); i++)
+        {
+            for (size_t j = 0; j < m_units[i].dependsOn.size(); j++)
+            {
+                auto it = unitsByIdentifier.find(m_units[i].dependsOn[j]);
+                if (it == unitsByIdentifier.end())
+                {
+                    auto const& node = m_unitNodes[i]->Find(L"dependsOn")->items[j];
+                    ThrowError(ConfigurationFileErrorCode::MissingDependency, L"dependsOn", node.value, node.line, node.column);
+                }
+
+                dependencies[i].push_back(it->second);
+            }
+        }
+
+        // Depth-first search with an explicit stack. A unit that is reached again while it is on the stack is
+        // part of a cycle.
+        enum class VisitState : uint8_t
+        {
+            NotVisited,
+            InProgress,
+            Done,
+        };
+
+        std::vector<VisitState> states(m_units.size(), VisitState::NotVisited);
+        for (size_t start = 0; start < m_units.size(); start++)
+        {
+            if (states[start] != VisitState::NotVisited)
+            {
+                continue;
+            }
+
+            std::vector<std::pair<size_t, size_t>> stack{ { start, 0 } };
+            states[start] = VisitState::InProgress;
+            while (!stack.empty())
+            {
+                auto& [unit, nextDependency] = stack.back();
+                if (nextDependency == dependencies[unit].size())
+                {
+                    states[unit] = VisitState::Done;
+                    stack.pop_back();
+                    continue;
+                }
+
+                auto dependency = dependencies[unit][nextDependency++];
+                if (states[dependency] == VisitState::InProgress)
+                {
+                    auto const& node = *m_unitNodes[unit]->Find(L"dependsOn");
+                    ThrowError(ConfigurationFileErrorCode::DependencyCycle, L"dependsOn", m_units[dependency].identifier, node.line, node.column);
+                }
+
+                if (states[dependency] == VisitState::NotVisited)
+                {
+                    states[dependency] = VisitState::InProgress;
+                    stack.emplace_back(dependency, 0);
+                }
+            }
+        }
+    }
+}
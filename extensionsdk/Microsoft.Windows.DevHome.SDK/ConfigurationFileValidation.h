@@ -0,0 +1,112 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    // A node of a YAML document. Mappings keep their entries in the order of the file.
+    struct ConfigurationYamlNode
+    {
+        enum class Kind
+        {
+            Null,
+            Scalar,
+            Mapping,
+            Sequence,
+        };
+
+        // The YAML core schema type of a scalar. Quoted scalars are always strings.
+        enum class ScalarType
+        {
+            Null,
+            Boolean,
+            Integer,
+            Float,
+            String,
+        };
+
+        Kind kind{ Kind::Null };
+        std::wstring value;
+        bool isQuoted{ false };
+        uint32_t line{ 0 };
+        uint32_t column{ 0 };
+        std::vector<std::pair<std::wstring, ConfigurationYamlNode>> entries;
+        std::vector<ConfigurationYamlNode> items;
+
+        ConfigurationYamlNode const* Find(std::wstring_view key) const;
+        ScalarType GetScalarType() const;
+        bool GetBoolean() const;
+        int64_t GetInteger() const;
+        double GetFloat() const;
+    };
+
+    // The error codes of the WinGet configuration processor, so that Dev Home handles the errors found here like
+    // the ones reported by OpenConfigurationSet.
+    namespace ConfigurationFileErrorCode
+    {
+        constexpr int32_t InvalidConfigurationFile = static_cast<int32_t>(0x8A15C001);
+        constexpr int32_t InvalidYaml = static_cast<int32_t>(0x8A15C002);
+        constexpr int32_t InvalidFieldType = static_cast<int32_t>(0x8A15C003);
+        constexpr int32_t UnknownConfigurationFileVersion = static_cast<int32_t>(0x8A15C004);
+        constexpr int32_t DuplicateIdentifier = static_cast<int32_t>(0x8A15C006);
+        constexpr int32_t MissingDependency = static_cast<int32_t>(0x8A15C007);
+        constexpr int32_t DependencyUnsatisfied = static_cast<int32_t>(0x8A15C008);
+        constexpr int32_t DependencyCycle = static_cast<int32_t>(0x8A15C00C);
+        constexpr int32_t InvalidFieldValue = static_cast<int32_t>(0x8A15C00D);
+        constexpr int32_t MissingField = static_cast<int32_t>(0x8A15C00E);
+    }
+
+    // Lines and columns start at 1. isUnsupported is set when the file uses YAML or configuration features that
+    // are only handled by the configuration processor, in which case the file may still be valid.
+    struct ConfigurationFileError
+    {
+        int32_t resultCode;
+        std::wstring field;
+        std::wstring value;
+        uint32_t line;
+        uint32_t column;
+        bool isUnsupported;
+    };
+
+    struct ConfigurationFileUnit
+    {
+        std::wstring resource;
+        std::wstring identifier;
+        bool isAssertion;
+        std::vector<std::wstring> dependsOn;
+
+        // A mapping, or null when the unit has no settings.
+        ConfigurationYamlNode settings;
+    };
+
+    // Parses and validates a configuration file in a single pass over its lines. Only the block and flow styles
+    // used by configuration files are supported: anchors, aliases, tags, complex keys, multi-line quoted scalars,
+    // multiple documents and nodes nested more than 256 levels deep are reported as unsupported. The file is
+    // checked against the structure of configuration versions 0.1 and 0.2, as the configuration processor would
+    // check it before applying it. This code only depends on the C++ standard library, so it can be tested on any
+    // platform.
+    class ConfigurationFile
+    {
+    public:
+        static ConfigurationFile Parse(std::wstring_view text);
+
+        // Set when the file is invalid or unsupported, in which case there are no units.
+        std::optional<ConfigurationFileError> const& Error() const;
+
+        std::wstring const& ConfigurationVersion() const;
+
+        // The assertions, then the resources, in the order of the file.
+        std::vector<ConfigurationFileUnit> const& Units() const;
+
+    private:
+        void Validate(ConfigurationYamlNode const& root);
+        void AddUnits(ConfigurationYamlNode const& properties, std::wstring_view field, bool isAssertion);
+        void ValidateDependencies();
+
+        std::optional<ConfigurationFileError> m_error;
+        std::wstring m_configurationVersion;
+        std::vector<ConfigurationFileUnit> m_units;
+        std::vector<ConfigurationYamlNode const*> m_unitNodes;
+    };
+}
@@ -12,10 +12,34 @@ namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
         IVector<DevHomeSDKProjection::ConfigurationUnit> const& units,
         ValueSet const& settings,
         DevHomeSDKProjection::ConfigurationUnitIntent const& intent) :
-        m_type(type), m_identifier(identifier), m_state(state), m_isGroup(isGroup), m_units(units), m_settings(settings), m_intent(intent)
+        m_type(type), m_identifier(identifier), m_state(state), m_isGroup(isGroup), m_units(units), m_intent(intent), m_settings(settings)
     {
     }
 
+    ConfigurationUnit::ConfigurationUnit(
+        hstring const& type,
+        hstring const& identifier,
+        ConfigurationUnitState const& state,
+        bool isGroup,
+        IVector<DevHomeSDKProjection::ConfigurationUnit> const& units,
+        DevHomeSDKProjection::ConfigurationUnitSettings const& settings,
+        DevHomeSDKProjection::ConfigurationUnitIntent const& intent) :
+        m_type(type), m_identifier(identifier), m_state(state), m_isGroup(isGroup), m_units(units), m_intent(intent), m_compactSettings(settings)
+    {
+    }
+
+    DevHomeSDKProjection::ConfigurationUnit ConfigurationUnit::CreateWithCompactSettings(
+        hstring const& type,
+        hstring const& identifier,
+        ConfigurationUnitState const& state,
+        bool isGroup,
+        IVector<DevHomeSDKProjection::ConfigurationUnit> const& units,
+        DevHomeSDKProjection::ConfigurationUnitSettings const& settings,
+        DevHomeSDKProjection::ConfigurationUnitIntent const& intent)
+    {
+        return make<ConfigurationUnit>(type, identifier, state, isGroup, units, settings, intent);
+    }
+
     hstring ConfigurationUnit::Type()
     {
         return m_type;
@@ -43,6 +67,12 @@ namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
 
     ValueSet ConfigurationUnit::Settings()
     {
+        std::lock_guard lock(m_settingsMutex);
+        if (!m_settings && m_compactSettings)
+        {
+            m_settings = m_compactSettings.ToValueSet();
+        }
+
         return m_settings;
     }
 
@@ -50,4 +80,15 @@ namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
     {
         return m_intent;
     }
+
+    DevHomeSDKProjection::ConfigurationUnitSettings ConfigurationUnit::CompactSettings()
+    {
+        std::lock_guard lock(m_settingsMutex);
+        if (!m_compactSettings)
+        {
+            m_compactSettings = DevHomeSDKProjection::ConfigurationUnitSettings::CreateFromValueSet(m_settings);
+        }
+
+        return m_compactSettings;
+    }
 }
@@ -17,6 +17,24 @@ namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
             ValueSet const& settings,
             DevHomeSDKProjection::ConfigurationUnitIntent const& intent);
 
+        ConfigurationUnit(
+            hstring const& type,
+            hstring const& identifier,
+            ConfigurationUnitState const& state,
+            bool isGroup,
+            IVector<DevHomeSDKProjection::ConfigurationUnit> const& units,
+            DevHomeSDKProjection::ConfigurationUnitSettings const& settings,
+            DevHomeSDKProjection::ConfigurationUnitIntent const& intent);
+
+        static DevHomeSDKProjection::ConfigurationUnit CreateWithCompactSettings(
+            hstring const& type,
+            hstring const& identifier,
+            ConfigurationUnitState const& state,
+            bool isGroup,
+            IVector<DevHomeSDKProjection::ConfigurationUnit> const& units,
+            DevHomeSDKProjection::ConfigurationUnitSettings const& settings,
+            DevHomeSDKProjection::ConfigurationUnitIntent const& intent);
+
         hstring Type();
         hstring Identifier();
         ConfigurationUnitState State();
@@ -24,6 +42,7 @@ namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
         IVector<DevHomeSDKProjection::ConfigurationUnit> Units();
         ValueSet Settings();
         DevHomeSDKProjection::ConfigurationUnitIntent Intent();
+        DevHomeSDKProjection::ConfigurationUnitSettings CompactSettings();
 
     private:
         hstring m_type;
@@ -31,8 +50,12 @@ namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
         ConfigurationUnitState m_state;
         bool m_isGroup;
         IVector<DevHomeSDKProjection::ConfigurationUnit> m_units;
-        ValueSet m_settings;
         DevHomeSDKProjection::ConfigurationUnitIntent m_intent;
+
+        // Either form of the settings is created from the other when it is first requested.
+        std::mutex m_settingsMutex;
+        ValueSet m_settings{ nullptr };
+        DevHomeSDKProjection::ConfigurationUnitSettings m_compactSettings{ nullptr };
     };
 }
 namespace winrt::Microsoft::Windows::DevHome::SDK::factory_implementation
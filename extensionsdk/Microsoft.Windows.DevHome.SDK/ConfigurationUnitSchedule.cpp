@@ -0,0 +1,156 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "ConfigurationUnitSchedule.h"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    ConfigurationUnitSchedule::ConfigurationUnitSchedule(std::vector<ConfigurationScheduledUnit> const& units) :
+        m_dependents(units.size()),
+        m_dependencyCounts(units.size(), 0),
+        m_isAssert(units.size(), false),
+        m_isCompleted(units.size(), false)
+    {
+        auto unitCount = static_cast<uint32_t>(units.size());
+        std::unordered_map<std::wstring_view, uint32_t> unitsByIdentifier;
+        for (uint32_t i = 0; i < unitCount; i++)
+        {
+            m_isAssert[i] = units[i].isAssert;
+            m_pendingAssertionCount += units[i].isAssert ? 1 : 0;
+            auto const& identifier = units[i].identifier;
+            if (!identifier.empty() && !unitsByIdentifier.emplace(identifier, i).second)
+            {
+                SetError(L"More than one unit has the identifier '" + identifier + L"'.");
+                return;
+            }
+        }
+
+        for (uint32_t i = 0; i < unitCount; i++)
+        {
+            for (auto const& dependency : units[i].dependsOn)
+            {
+                auto it = unitsByIdentifier.find(dependency);
+                if (it == unitsByIdentifier.end())
+                {
+                    SetError(L"The unit '" + units[i].identifier + L"' depends on '" + dependency + L"', which doesn't exist.");
+                    return;
+                }
+
+                // Assertions run before the other units, so they can't wait for them.
+                if (m_isAssert[i] && !m_isAssert[it->second])
+                {
+                    SetError(L"The assertion '" + units[i].identifier + L"' depends on '" + dependency + L"', which isn't an assertion.");
+                    return;
+                }
+
+                m_dependents[it->second].push_back(i);
+                m_dependencyCounts[i]++;
+            }
+        }
+
+        // Every unit can be reached by removing units without dependencies, unless there is a cycle.
+        auto dependencyCounts = m_dependencyCounts;
+        std::vector<uint32_t> reachableUnits;
+        for (uint32_t i = 0; i < unitCount; i++)
+        {
+            if (dependencyCounts[i] == 0)
+            {
+                reachableUnits.push_back(i);
+                (m_isAssert[i] ? m_readyAssertions : m_readyUnits).insert(i);
+            }
+        }
+
+        uint32_t reachedCount = 0;
+        while (!reachableUnits.empty())
+        {
+            auto unit = reachableUnits.back();
+            reachableUnits.pop_back();
+            reachedCount++;
+            for (auto dependent : m_dependents[unit])
+            {
+                if (--dependencyCounts[dependent] == 0)
+                {
+                    reachableUnits.push_back(dependent);
+                }
+            }
+        }
+
+        if (reachedCount != unitCount)
+        {
+            SetError(L"The dependencies of the units form a cycle.");
+        }
+    }
+
+    std::optional<std::wstring> const& ConfigurationUnitSchedule::Error() const
+    {
+        return m_error;
+    }
+
+    std::optional<uint32_t> ConfigurationUnitSchedule::TryStartNext()
+    {
+        auto& ready = !m_readyAssertions.empty() ? m_readyAssertions : m_readyUnits;
+        if (ready.empty() || (&ready == &m_readyUnits && m_pendingAssertionCount > 0))
+        {
+            return std::nullopt;
+        }
+
+        auto unitIndex = *ready.begin();
+        ready.erase(ready.begin());
+        return unitIndex;
+    }
+
+    void ConfigurationUnitSchedule::Complete(uint32_t unitIndex, bool isSuccessful, std::vector<uint32_t>& skippedUnits)
+    {
+        MarkCompleted(unitIndex);
+        if (isSuccessful)
+        {
+            for (auto dependent : m_dependents[unitIndex])
+            {
+                if (--m_dependencyCounts[dependent] == 0)
+                {
+                    (m_isAssert[dependent] ? m_readyAssertions : m_readyUnits).insert(dependent);
+                }
+            }
+
+            return;
+        }
+
+        // Units that depend on a unit that failed are skipped, and so are the units that depend on them. None of
+        // them can be ready, since a unit that failed is one of their dependencies.
+        std::vector<uint32_t> failedUnits{ unitIndex };
+        while (!failedUnits.empty())
+        {
+            auto failedUnit = failedUnits.back();
+            failedUnits.pop_back();
+            for (auto dependent : m_dependents[failedUnit])
+            {
+                if (!m_isCompleted[dependent])
+                {
+                    MarkCompleted(dependent);
+                    skippedUnits.push_back(dependent);
+                    failedUnits.push_back(dependent);
+                }
+            }
+        }
+    }
+
+    bool ConfigurationUnitSchedule::IsCompleted() const
+    {
+        return m_completedUnitCount == m_isCompleted.size();
+    }
+
+    void ConfigurationUnitSchedule::SetError(std::wstring&& error)
+    {
+        m_error = std::move(error);
+        m_readyAssertions.clear();
+        m_readyUnits.clear();
+    }
+
+    void ConfigurationUnitSchedule::MarkCompleted(uint32_t unitIndex)
+    {
+        m_isCompleted[unitIndex] = true;
+        m_completedUnitCount++;
+        m_pendingAssertionCount -= m_isAssert[unitIndex] ? 1 : 0;
+    }
+}
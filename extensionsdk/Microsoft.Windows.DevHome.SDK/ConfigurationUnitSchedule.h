@@ -0,0 +1,58 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    // A unit as ConfigurationUnitSchedule sees it. An empty identifier can't be depended on.
+    struct ConfigurationScheduledUnit
+    {
+        std::wstring identifier;
+        bool isAssert{ false };
+        std::vector<std::wstring> dependsOn;
+    };
+
+    // Decides the order ConfigurationApplyScheduler applies units in. Units are referred to by their index in the
+    // vector passed to the constructor. A unit becomes ready when every unit it depends on completed successfully,
+    // assertions are started before any other unit, and ready units are started in the order they were added.
+    // The schedule doesn't know how many units run at the same time, callers only take as many ready units as
+    // they can start. This code only depends on the C++ standard library, so it can be tested and benchmarked on
+    // any platform. The class is not thread safe.
+    class ConfigurationUnitSchedule
+    {
+    public:
+        // Error is set when a dependency doesn't exist, identifiers are duplicated, the dependencies form a cycle,
+        // or an assertion depends on a unit that isn't an assertion. Such a schedule has no ready units.
+        explicit ConfigurationUnitSchedule(std::vector<ConfigurationScheduledUnit> const& units);
+
+        std::optional<std::wstring> const& Error() const;
+
+        // Returns the next unit to start and considers it started, or nothing when no unit is ready. Units that
+        // aren't assertions are only returned once every assertion completed.
+        std::optional<uint32_t> TryStartNext();
+
+        // Completes a started unit. When it failed, every unit that depends on it directly or indirectly is
+        // skipped, completed and added to skippedUnits, in an order where a unit follows the unit that caused
+        // it to be skipped.
+        void Complete(uint32_t unitIndex, bool isSuccessful, std::vector<uint32_t>& skippedUnits);
+
+        bool IsCompleted() const;
+
+    private:
+        void SetError(std::wstring&& error);
+        void MarkCompleted(uint32_t unitIndex);
+
+        std::optional<std::wstring> m_error;
+
+        // The units that depend on each unit, and the number of units each unit still waits for.
+        std::vector<std::vector<uint32_t>> m_dependents;
+        std::vector<uint32_t> m_dependencyCounts;
+        std::vector<bool> m_isAssert;
+        std::vector<bool> m_isCompleted;
+        std::set<uint32_t> m_readyAssertions;
+        std::set<uint32_t> m_readyUnits;
+        uint32_t m_pendingAssertionCount{ 0 };
+        uint32_t m_completedUnitCount{ 0 };
+    };
+}
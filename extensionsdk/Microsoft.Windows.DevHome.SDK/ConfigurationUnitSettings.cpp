@@ -0,0 +1,593 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "ConfigurationUnitSettings.h"
+#include "ConfigurationUnitSettings.g.cpp"
+#include "Fnv1aHash.h"
+
+using namespace winrt::Windows::Foundation;
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    namespace
+    {
+        // Identifies the type of a value in the content hash. Don't change the values, the hash must be stable.
+        enum class HashedType : uint8_t
+        {
+            String = 1,
+            Int64 = 2,
+            Double = 3,
+            Boolean = 4,
+            Settings = 5,
+            PropertyValue = 6,
+            Null = 7,
+        };
+
+        void AddValue(Fnv1aHash& hasher, hstring const& value)
+        {
+            hasher.AddString(value);
+        }
+
+        template <typename T>
+        void AddValue(Fnv1aHash& hasher, T const& value)
+        {
+            if constexpr (std::is_same_v<T, bool>)
+            {
+                hasher.AddByte(value ? 1 : 0);
+            }
+            else if constexpr (std::is_integral_v<T>)
+            {
+                hasher.AddUInt64(static_cast<uint64_t>(value));
+            }
+            else if constexpr (std::is_same_v<T, float>)
+            {
+                uint32_t bits;
+                std::memcpy(&bits, &value, sizeof(bits));
+                hasher.AddUInt64(bits);
+            }
+            else if constexpr (std::is_same_v<T, double>)
+            {
+                uint64_t bits;
+                std::memcpy(&bits, &value, sizeof(bits));
+                hasher.AddUInt64(bits);
+            }
+            else if constexpr (std::is_same_v<T, DateTime> || std::is_same_v<T, TimeSpan>)
+            {
+                hasher.AddUInt64(static_cast<uint64_t>(value.time_since_epoch().count()));
+            }
+            else if constexpr (std::is_same_v<T, guid>)
+            {
+                hasher.AddUInt64(value.Data1);
+                hasher.AddUInt64(value.Data2);
+                hasher.AddUInt64(value.Data3);
+                hasher.AddBytes(value.Data4, sizeof(value.Data4));
+            }
+            else if constexpr (std::is_same_v<T, Point>)
+            {
+                AddValue(hasher, value.X);
+                AddValue(hasher, value.Y);
+            }
+            else if constexpr (std::is_same_v<T, Size>)
+            {
+                AddValue(hasher, value.Width);
+                AddValue(hasher, value.Height);
+            }
+            else
+            {
+                static_assert(std::is_same_v<T, Rect>);
+                AddValue(hasher, value.X);
+                AddValue(hasher, value.Y);
+                AddValue(hasher, value.Width);
+                AddValue(hasher, value.Height);
+            }
+        }
+
+        template <typename T, typename GetArray>
+        void AddArray(Fnv1aHash& hasher, GetArray&& getArray)
+        {
+            com_array<T> values;
+            getArray(values);
+            hasher.AddUInt64(values.size());
+            for (auto const& value : values)
+            {
+                AddValue(hasher, value);
+            }
+        }
+
+        bool AddObject(Fnv1aHash& hasher, IInspectable const& value);
+
+        // Returns false for values whose content can't be hashed.
+        bool AddPropertyValue(Fnv1aHash& hasher, IPropertyValue const& value)
+        {
+            auto type = value.Type();
+            hasher.AddUInt64(static_cast<uint64_t>(type));
+            switch (type)
+            {
+            case PropertyType::Empty:
+                return true;
+            case PropertyType::UInt8:
+                AddValue(hasher, value.GetUInt8());
+                return true;
+            case PropertyType::Int16:
+                AddValue(hasher, value.GetInt16());
+                return true;
+            case PropertyType::UInt16:
+                AddValue(hasher, value.GetUInt16());
+                return true;
+            case PropertyType::Int32:
+                AddValue(hasher, value.GetInt32());
+                return true;
+            case PropertyType::UInt32:
+                AddValue(hasher, value.GetUInt32());
+                return true;
+            case PropertyType::Int64:
+                AddValue(hasher, value.GetInt64());
+                return true;
+            case PropertyType::UInt64:
+                AddValue(hasher, value.GetUInt64());
+                return true;
+            case PropertyType::Single:
+                AddValue(hasher, value.GetSingle());
+                return true;
+            case PropertyType::Double:
+                AddValue(hasher, value.GetDouble());
+                return true;
+            case PropertyType::Char16:
+                AddValue(hasher, value.GetChar16());
+                return true;
+            case PropertyType::Boolean:
+                AddValue(hasher, value.GetBoolean());
+                return true;
+            case PropertyType::String:
+                AddValue(hasher, value.GetString());
+                return true;
+            case PropertyType::DateTime:
+                AddValue(hasher, value.GetDateTime());
+                return true;
+            case PropertyType::TimeSpan:
+                AddValue(hasher, value.GetTimeSpan());
+                return true;
+            case PropertyType::Guid:
+                AddValue(hasher, value.GetGuid());
+                return true;
+            case PropertyType::Point:
+                AddValue(hasher, value.GetPoint());
+                return true;
+            case PropertyType::Size:
+                AddValue(hasher, value.GetSize());
+                return true;
+            case PropertyType::Rect:
+                AddValue(hasher, value.GetRect());
+                return true;
+            case PropertyType::UInt8Array:
+                AddArray<uint8_t>(hasher, [&](auto& values) { value.GetUInt8Array(values); });
+                return true;
+            case PropertyType::Int16Array:
+                AddArray<int16_t>(hasher, [&](auto& values) { value.GetInt16Array(values); });
+                return true;
+            case PropertyType::UInt16Array:
+                AddArray<uint16_t>(hasher, [&](auto& values) { value.GetUInt16Array(values); });
+                return true;
+            case PropertyType::Int32Array:
+                AddArray<int32_t>(hasher, [&](auto& values) { value.GetInt32Array(values); });
+                return true;
+            case PropertyType::UInt32Array:
+                AddArray<uint32_t>(hasher, [&](auto& values) { value.GetUInt32Array(values); });
+                return true;
+            case PropertyType::Int64Array:
+                AddArray<int64_t>(hasher, [&](auto& values) { value.GetInt64Array(values); });
+                return true;
+            case PropertyType::UInt64Array:
+                AddArray<uint64_t>(hasher, [&](auto& values) { value.GetUInt64Array(values); });
+                return true;
+            case PropertyType::SingleArray:
+                AddArray<float>(hasher, [&](auto& values) { value.GetSingleArray(values); });
+                return true;
+            case PropertyType::DoubleArray:
+                AddArray<double>(hasher, [&](auto& values) { value.GetDoubleArray(values); });
+                return true;
+            case PropertyType::Char16Array:
+                AddArray<char16_t>(hasher, [&](auto& values) { value.GetChar16Array(values); });
+                return true;
+            case PropertyType::BooleanArray:
+                AddArray<bool>(hasher, [&](auto& values) { value.GetBooleanArray(values); });
+                return true;
+            case PropertyType::StringArray:
+                AddArray<hstring>(hasher, [&](auto& values) { value.GetStringArray(values); });
+                return true;
+            case PropertyType::DateTimeArray:
+                AddArray<DateTime>(hasher, [&](auto& values) { value.GetDateTimeArray(values); });
+                return true;
+            case PropertyType::TimeSpanArray:
+                AddArray<TimeSpan>(hasher, [&](auto& values) { value.GetTimeSpanArray(values); });
+                return true;
+            case PropertyType::GuidArray:
+                AddArray<guid>(hasher, [&](auto& values) { value.GetGuidArray(values); });
+                return true;
+            case PropertyType::PointArray:
+                AddArray<Point>(hasher, [&](auto& values) { value.GetPointArray(values); });
+                return true;
+            case PropertyType::SizeArray:
+                AddArray<Size>(hasher, [&](auto& values) { value.GetSizeArray(values); });
+                return true;
+            case PropertyType::RectArray:
+                AddArray<Rect>(hasher, [&](auto& values) { value.GetRectArray(values); });
+                return true;
+            case PropertyType::InspectableArray:
+            {
+                com_array<IInspectable> values;
+                value.GetInspectableArray(values);
+                hasher.AddUInt64(values.size());
+                return std::all_of(values.begin(), values.end(), [&hasher](IInspectable const& element) {
+                    return AddObject(hasher, element);
+                });
+            }
+            default:
+                return false;
+            }
+        }
+
+        // Returns false for values whose content can't be hashed.
+        bool AddObject(Fnv1aHash& hasher, IInspectable const& value)
+        {
+            if (!value)
+            {
+                hasher.AddByte(static_cast<uint8_t>(HashedType::Null));
+                return true;
+            }
+
+            if (auto settings = value.try_as<Projection::ConfigurationUnitSettings>())
+            {
+                auto contentHash = settings.ContentHash();
+                hasher.AddByte(static_cast<uint8_t>(HashedType::Settings));
+                hasher.AddString(contentHash);
+                return !contentHash.empty();
+            }
+
+            if (auto propertyValue = value.try_as<IPropertyValue>())
+            {
+                hasher.AddByte(static_cast<uint8_t>(HashedType::PropertyValue));
+                return AddPropertyValue(hasher, propertyValue);
+            }
+
+            return false;
+        }
+
+        [[noreturn]] void ThrowTypeMismatch(hstring const& key)
+        {
+            throw hresult_illegal_method_call(L"The value of setting '" + key + L"' has a different type.");
+        }
+
+        IInspectable BoxValue(ConfigurationUnitSettings::SettingValue const& value)
+        {
+            return std::visit([](auto const& typedValue) -> IInspectable {
+                return box_value(typedValue);
+            }, value);
+        }
+
+        PropertyType GetSettingValueType(ConfigurationUnitSettings::SettingValue const& value)
+        {
+            return std::visit([](auto const& typedValue) {
+                using T = std::decay_t<decltype(typedValue)>;
+                if constexpr (std::is_same_v<T, hstring>)
+                {
+                    return PropertyType::String;
+                }
+                else if constexpr (std::is_same_v<T, int64_t>)
+                {
+                    return PropertyType::Int64;
+                }
+                else if constexpr (std::is_same_v<T, double>)
+                {
+                    return PropertyType::Double;
+                }
+                else if constexpr (std::is_same_v<T, bool>)
+                {
+                    return PropertyType::Boolean;
+                }
+                else if constexpr (std::is_same_v<T, Projection::ConfigurationUnitSettings>)
+                {
+                    return PropertyType::Inspectable;
+                }
+                else
+                {
+                    static_assert(std::is_same_v<T, IInspectable>);
+                    auto propertyValue = typedValue.template try_as<IPropertyValue>();
+                    return propertyValue ? propertyValue.Type() : PropertyType::Inspectable;
+                }
+            }, value);
+        }
+
+        template <typename T>
+        T GetValue(ConfigurationUnitSettings::SettingValue const* value, hstring const& key, T const& defaultValue)
+        {
+            if (!value)
+            {
+                return defaultValue;
+            }
+
+            if (auto typedValue = std::get_if<T>(value))
+            {
+                return *typedValue;
+            }
+
+            ThrowTypeMismatch(key);
+        }
+    }
+
+    ConfigurationUnitSettings::ConfigurationUnitSettings(std::vector<Setting>&& settings) :
+        m_settings(std::move(settings))
+    {
+        Fnv1aHash hasher;
+        auto isHashed = true;
+        for (auto const& [key, value] : m_settings)
+        {
+            hasher.AddString(key);
+            if (auto stringValue = std::get_if<hstring>(&value))
+            {
+                hasher.AddByte(static_cast<uint8_t>(HashedType::String));
+                hasher.AddString(*stringValue);
+            }
+            else if (auto int64Value = std::get_if<int64_t>(&value))
+            {
+                hasher.AddByte(static_cast<uint8_t>(HashedType::Int64));
+                hasher.AddUInt64(static_cast<uint64_t>(*int64Value));
+            }
+            else if (auto doubleValue = std::get_if<double>(&value))
+            {
+                uint64_t bits;
+                std::memcpy(&bits, doubleValue, sizeof(bits));
+                hasher.AddByte(static_cast<uint8_t>(HashedType::Double));
+                hasher.AddUInt64(bits);
+            }
+            else if (auto booleanValue = std::get_if<bool>(&value))
+            {
+                hasher.AddByte(static_cast<uint8_t>(HashedType::Boolean));
+                hasher.AddByte(*booleanValue ? 1 : 0);
+            }
+            else if (auto settingsValue = std::get_if<Projection::ConfigurationUnitSettings>(&value))
+            {
+                isHashed = AddObject(hasher, *settingsValue) && isHashed;
+            }
+            else
+            {
+                isHashed = AddObject(hasher, std::get<IInspectable>(value)) && isHashed;
+            }
+        }
+
+        // Equal hashes must mean equal settings, so there is no hash when a value can't be compared.
+        if (isHashed)
+        {
+            m_contentHash = hstring{ hasher.ToHexString() };
+        }
+    }
+
+    Projection::ConfigurationUnitSettings ConfigurationUnitSettings::CreateFromValueSet(ValueSet const& settings)
+    {
+        // Nested settings often repeat the same keys, like the items of an array of objects.
+        KeyInterner keys;
+        return make<ConfigurationUnitSettings>(CopySettings(settings, keys));
+    }
+
+    hstring ConfigurationUnitSettings::InternKey(KeyInterner& keys, hstring const& key)
+    {
+        return *keys.insert(key).first;
+    }
+
+    ConfigurationUnitSettings::SettingValue ConfigurationUnitSettings::ToSettingValue(IInspectable const& value)
+    {
+        KeyInterner keys;
+        return ToSettingValue(value, keys);
+    }
+
+    ConfigurationUnitSettings::SettingValue ConfigurationUnitSettings::ToSettingValue(IInspectable const& value, KeyInterner& keys)
+    {
+        if (!value)
+        {
+            return SettingValue{ std::in_place_type<IInspectable>, nullptr };
+        }
+
+        if (auto settings = value.try_as<Projection::ConfigurationUnitSettings>())
+        {
+            return SettingValue{ std::in_place_type<Projection::ConfigurationUnitSettings>, settings };
+        }
+
+        if (auto propertySet = value.try_as<IPropertySet>())
+        {
+            return SettingValue{ std::in_place_type<Projection::ConfigurationUnitSettings>, make<ConfigurationUnitSettings>(CopySettings(propertySet, keys)) };
+        }
+
+        if (auto propertyValue = value.try_as<IPropertyValue>())
+        {
+            switch (propertyValue.Type())
+            {
+            case PropertyType::String:
+                return SettingValue{ std::in_place_type<hstring>, propertyValue.GetString() };
+            case PropertyType::Boolean:
+                return SettingValue{ std::in_place_type<bool>, propertyValue.GetBoolean() };
+            case PropertyType::UInt8:
+            case PropertyType::Int16:
+            case PropertyType::UInt16:
+            case PropertyType::Int32:
+            case PropertyType::UInt32:
+            case PropertyType::Int64:
+                return SettingValue{ std::in_place_type<int64_t>, propertyValue.GetInt64() };
+            case PropertyType::UInt64:
+                if (auto uint64Value = propertyValue.GetUInt64(); uint64Value <= INT64_MAX)
+                {
+                    return SettingValue{ std::in_place_type<int64_t>, static_cast<int64_t>(uint64Value) };
+                }
+
+                break;
+            case PropertyType::Single:
+            case PropertyType::Double:
+                return SettingValue{ std::in_place_type<double>, propertyValue.GetDouble() };
+            default:
+                break;
+            }
+        }
+
+        return SettingValue{ std::in_place_type<IInspectable>, value };
+    }
+
+    std::vector<ConfigurationUnitSettings::Setting>::iterator ConfigurationUnitSettings::FindSetting(std::vector<Setting>& settings, hstring const& key)
+    {
+        return std::lower_bound(settings.begin(), settings.end(), key, [](Setting const& setting, hstring const& value) {
+            return setting.first < value;
+        });
+    }
+
+    uint32_t ConfigurationUnitSettings::Size()
+    {
+        return static_cast<uint32_t>(m_settings.size());
+    }
+
+    com_array<hstring> ConfigurationUnitSettings::Keys()
+    {
+        com_array<hstring> keys(static_cast<uint32_t>(m_settings.size()));
+        std::transform(m_settings.begin(), m_settings.end(), keys.begin(), [](Setting const& setting) {
+            return setting.first;
+        });
+
+        return keys;
+    }
+
+    hstring ConfigurationUnitSettings::ContentHash()
+    {
+        return m_contentHash;
+    }
+
+    com_array<Projection::ConfigurationUnitSettingEntry> ConfigurationUnitSettings::Entries()
+    {
+        std::vector<Projection::ConfigurationUnitSettingEntry> entries;
+        entries.reserve(m_settings.size());
+        for (auto const& [key, value] : m_settings)
+        {
+            Projection::ConfigurationUnitSettingEntry entry{};
+            entry.Key = key;
+            entry.ValueType = GetSettingValueType(value);
+            if (auto stringValue = std::get_if<hstring>(&value))
+            {
+                entry.StringValue = *stringValue;
+            }
+            else if (auto int64Value = std::get_if<int64_t>(&value))
+            {
+                entry.Int64Value = *int64Value;
+            }
+            else if (auto doubleValue = std::get_if<double>(&value))
+            {
+                entry.DoubleValue = *doubleValue;
+            }
+            else if (auto booleanValue = std::get_if<bool>(&value))
+            {
+                entry.BooleanValue = *booleanValue;
+            }
+            else if (auto settingsValue = std::get_if<Projection::ConfigurationUnitSettings>(&value))
+            {
+                // Nested settings may come from another copy of the SDK, so they are read through the projection.
+                auto nestedEntries = settingsValue->Entries();
+                entry.IsSettings = true;
+                entry.NestedEntryCount = nestedEntries.size();
+                entries.push_back(std::move(entry));
+                entries.insert(entries.end(), nestedEntries.begin(), nestedEntries.end());
+                continue;
+            }
+
+            entries.push_back(std::move(entry));
+        }
+
+        return com_array<Projection::ConfigurationUnitSettingEntry>(entries.begin(), entries.end());
+    }
+
+    bool ConfigurationUnitSettings::HasKey(hstring const& key)
+    {
+        return Find(key) != nullptr;
+    }
+
+    PropertyType ConfigurationUnitSettings::GetValueType(hstring const& key)
+    {
+        auto value = Find(key);
+        if (!value)
+        {
+            return PropertyType::Empty;
+        }
+
+        return GetSettingValueType(*value);
+    }
+
+    hstring ConfigurationUnitSettings::GetString(hstring const& key, hstring const& defaultValue)
+    {
+        return GetValue(Find(key), key, defaultValue);
+    }
+
+    int64_t ConfigurationUnitSettings::GetInt64(hstring const& key, int64_t defaultValue)
+    {
+        return GetValue(Find(key), key, defaultValue);
+    }
+
+    double ConfigurationUnitSettings::GetDouble(hstring const& key, double defaultValue)
+    {
+        return GetValue(Find(key), key, defaultValue);
+    }
+
+    bool ConfigurationUnitSettings::GetBoolean(hstring const& key, bool defaultValue)
+    {
+        return GetValue(Find(key), key, defaultValue);
+    }
+
+    Projection::ConfigurationUnitSettings ConfigurationUnitSettings::GetSettings(hstring const& key)
+    {
+        return GetValue(Find(key), key, Projection::ConfigurationUnitSettings{ nullptr });
+    }
+
+    IInspectable ConfigurationUnitSettings::Lookup(hstring const& key)
+    {
+        auto value = Find(key);
+        return value ? BoxValue(*value) : nullptr;
+    }
+
+    ValueSet ConfigurationUnitSettings::ToValueSet()
+    {
+        ValueSet valueSet;
+        for (auto const& [key, value] : m_settings)
+        {
+            if (auto settingsValue = std::get_if<Projection::ConfigurationUnitSettings>(&value))
+            {
+                valueSet.Insert(key, settingsValue->ToValueSet());
+            }
+            else
+            {
+                valueSet.Insert(key, BoxValue(value));
+            }
+        }
+
+        return valueSet;
+    }
+
+    std::vector<ConfigurationUnitSettings::Setting> ConfigurationUnitSettings::CopySettings(IPropertySet const& settings, KeyInterner& keys)
+    {
+        std::vector<Setting> copy;
+        if (settings)
+        {
+            copy.reserve(settings.Size());
+            for (auto const& pair : settings)
+            {
+                copy.emplace_back(InternKey(keys, pair.Key()), ToSettingValue(pair.Value(), keys));
+            }
+
+            // Property sets have unique keys, so sorting them is enough.
+            std::sort(copy.begin(), copy.end(), [](Setting const& first, Setting const& second) {
+                return first.first < second.first;
+            });
+        }
+
+        return copy;
+    }
+
+    ConfigurationUnitSettings::SettingValue const* ConfigurationUnitSettings::Find(hstring const& key)
+    {
+        auto it = FindSetting(m_settings, key);
+        return (it != m_settings.end() && it->first == key) ? &it->second : nullptr;
+    }
+}
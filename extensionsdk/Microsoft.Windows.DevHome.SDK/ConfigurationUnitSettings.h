@@ -0,0 +1,61 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include "ConfigurationUnitSettings.g.h"
+
+using namespace winrt::Windows::Foundation::Collections;
+namespace Projection = winrt::Microsoft::Windows::DevHome::SDK;
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    struct ConfigurationUnitSettings : ConfigurationUnitSettingsT<ConfigurationUnitSettings>
+    {
+        using SettingValue = std::variant<hstring, int64_t, double, bool, Projection::ConfigurationUnitSettings, IInspectable>;
+        using Setting = std::pair<hstring, SettingValue>;
+
+        // Keys that were already used while creating a group of settings, so that settings which share keys also
+        // share the key strings. It only lives while the group is created.
+        using KeyInterner = std::unordered_set<hstring>;
+
+        // The settings must be sorted by key, without duplicate keys.
+        ConfigurationUnitSettings(std::vector<Setting>&& settings);
+
+        static Projection::ConfigurationUnitSettings CreateFromValueSet(ValueSet const& settings);
+
+        // Used by ConfigurationUnitSettingsBuilder and ConfigurationFileParseResult to store settings the same way.
+        static hstring InternKey(KeyInterner& keys, hstring const& key);
+        static SettingValue ToSettingValue(IInspectable const& value);
+        static std::vector<Setting>::iterator FindSetting(std::vector<Setting>& settings, hstring const& key);
+
+        uint32_t Size();
+        com_array<hstring> Keys();
+        hstring ContentHash();
+        com_array<Projection::ConfigurationUnitSettingEntry> Entries();
+        bool HasKey(hstring const& key);
+        winrt::Windows::Foundation::PropertyType GetValueType(hstring const& key);
+        hstring GetString(hstring const& key, hstring const& defaultValue);
+        int64_t GetInt64(hstring const& key, int64_t defaultValue);
+        double GetDouble(hstring const& key, double defaultValue);
+        bool GetBoolean(hstring const& key, bool defaultValue);
+        Projection::ConfigurationUnitSettings GetSettings(hstring const& key);
+        IInspectable Lookup(hstring const& key);
+        ValueSet ToValueSet();
+
+    private:
+        static std::vector<Setting> CopySettings(IPropertySet const& settings, KeyInterner& keys);
+        static SettingValue ToSettingValue(IInspectable const& value, KeyInterner& keys);
+
+        SettingValue const* Find(hstring const& key);
+
+        // Immutable, so the settings don't need a lock.
+        std::vector<Setting> m_settings;
+        hstring m_contentHash;
+    };
+}
+namespace winrt::Microsoft::Windows::DevHome::SDK::factory_implementation
+{
+    struct ConfigurationUnitSettings : ConfigurationUnitSettingsT<ConfigurationUnitSettings, implementation::ConfigurationUnitSettings>
+    {
+    };
+}
@@ -0,0 +1,63 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "ConfigurationUnitSettingsBuilder.h"
+#include "ConfigurationUnitSettingsBuilder.g.cpp"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    void ConfigurationUnitSettingsBuilder::SetString(hstring const& key, hstring const& value)
+    {
+        Set(key, ConfigurationUnitSettings::SettingValue{ std::in_place_type<hstring>, value });
+    }
+
+    void ConfigurationUnitSettingsBuilder::SetInt64(hstring const& key, int64_t value)
+    {
+        Set(key, ConfigurationUnitSettings::SettingValue{ std::in_place_type<int64_t>, value });
+    }
+
+    void ConfigurationUnitSettingsBuilder::SetDouble(hstring const& key, double value)
+    {
+        Set(key, ConfigurationUnitSettings::SettingValue{ std::in_place_type<double>, value });
+    }
+
+    void ConfigurationUnitSettingsBuilder::SetBoolean(hstring const& key, bool value)
+    {
+        Set(key, ConfigurationUnitSettings::SettingValue{ std::in_place_type<bool>, value });
+    }
+
+    void ConfigurationUnitSettingsBuilder::SetSettings(hstring const& key, Projection::ConfigurationUnitSettings const& value)
+    {
+        Set(key, ConfigurationUnitSettings::ToSettingValue(value));
+    }
+
+    void ConfigurationUnitSettingsBuilder::SetValue(hstring const& key, IInspectable const& value)
+    {
+        Set(key, ConfigurationUnitSettings::ToSettingValue(value));
+    }
+
+    Projection::ConfigurationUnitSettings ConfigurationUnitSettingsBuilder::Build()
+    {
+        std::vector<ConfigurationUnitSettings::Setting> settings;
+        {
+            std::lock_guard lock(m_mutex);
+            settings = m_settings;
+        }
+
+        return make<ConfigurationUnitSettings>(std::move(settings));
+    }
+
+    void ConfigurationUnitSettingsBuilder::Set(hstring const& key, ConfigurationUnitSettings::SettingValue&& value)
+    {
+        std::lock_guard lock(m_mutex);
+        auto it = ConfigurationUnitSettings::FindSetting(m_settings, key);
+        if (it != m_settings.end() && it->first == key)
+        {
+            it->second = std::move(value);
+            return;
+        }
+
+        m_settings.emplace(it, key, std::move(value));
+    }
+}
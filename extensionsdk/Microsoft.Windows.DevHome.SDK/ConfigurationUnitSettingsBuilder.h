@@ -0,0 +1,36 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include "ConfigurationUnitSettingsBuilder.g.h"
+#include "ConfigurationUnitSettings.h"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    struct ConfigurationUnitSettingsBuilder : ConfigurationUnitSettingsBuilderT<ConfigurationUnitSettingsBuilder>
+    {
+        ConfigurationUnitSettingsBuilder() = default;
+
+        void SetString(hstring const& key, hstring const& value);
+        void SetInt64(hstring const& key, int64_t value);
+        void SetDouble(hstring const& key, double value);
+        void SetBoolean(hstring const& key, bool value);
+        void SetSettings(hstring const& key, Projection::ConfigurationUnitSettings const& value);
+        void SetValue(hstring const& key, IInspectable const& value);
+        Projection::ConfigurationUnitSettings Build();
+
+    private:
+        void Set(hstring const& key, ConfigurationUnitSettings::SettingValue&& value);
+
+        std::mutex m_mutex;
+
+        // Sorted by key, like ConfigurationUnitSettings stores them.
+        std::vector<ConfigurationUnitSettings::Setting> m_settings;
+    };
+}
+namespace winrt::Microsoft::Windows::DevHome::SDK::factory_implementation
+{
+    struct ConfigurationUnitSettingsBuilder : ConfigurationUnitSettingsBuilderT<ConfigurationUnitSettingsBuilder, implementation::ConfigurationUnitSettingsBuilder>
+    {
+    };
+}
@@ -0,0 +1,132 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "ConfigurationUnitTable.h"
+#include "ConfigurationUnitTable.g.cpp"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    namespace
+    {
+        void AddUnits(IIterable<ConfigurationUnit> const& units, std::vector<ConfigurationUnit>& table)
+        {
+            if (!units)
+            {
+                return;
+            }
+
+            for (auto const& unit : units)
+            {
+                table.push_back(unit);
+                if (unit.IsGroup())
+                {
+                    AddUnits(unit.Units(), table);
+                }
+            }
+        }
+    }
+
+    ConfigurationUnitTable::ConfigurationUnitTable(array_view<ConfigurationUnit const> units) :
+        m_units(units.begin(), units.end())
+    {
+        BuildLookups();
+    }
+
+    ConfigurationUnitTable::ConfigurationUnitTable(std::vector<ConfigurationUnit>&& units) :
+        m_units(std::move(units))
+    {
+        BuildLookups();
+    }
+
+    winrt::Microsoft::Windows::DevHome::SDK::ConfigurationUnitTable ConfigurationUnitTable::CreateFromUnits(IIterable<ConfigurationUnit> const& units)
+    {
+        std::vector<ConfigurationUnit> table;
+        AddUnits(units, table);
+        return make<ConfigurationUnitTable>(std::move(table));
+    }
+
+    com_array<ConfigurationUnit> ConfigurationUnitTable::Units()
+    {
+        return com_array<ConfigurationUnit>(m_units.begin(), m_units.end());
+    }
+
+    uint32_t ConfigurationUnitTable::Size()
+    {
+        return static_cast<uint32_t>(m_units.size());
+    }
+
+    bool ConfigurationUnitTable::TryGetIndex(hstring const& identifier, uint32_t& index)
+    {
+        auto it = m_indexesByIdentifier.find(identifier);
+        if (it == m_indexesByIdentifier.end())
+        {
+            index = 0;
+            return false;
+        }
+
+        index = it->second;
+        return true;
+    }
+
+    ConfigurationSetChange ConfigurationUnitTable::CreateChange(ConfigurationSetChangeData const& changeData)
+    {
+        ConfigurationSetChange change{
+            changeData.Change(),
+            changeData.SetState(),
+            ConfigurationUnitState::Unknown,
+            0,
+            S_OK,
+            ConfigurationUnitResultSource::None };
+
+        if (change.Change != ConfigurationSetChangeEventType::UnitStateChanged)
+        {
+            return change;
+        }
+
+        auto unit = changeData.Unit();
+        if (!unit)
+        {
+            throw hresult_invalid_argument(L"The change data of a unit change has no unit.");
+        }
+
+        auto it = m_indexesByUnit.find(get_abi(unit));
+        if (it != m_indexesByUnit.end())
+        {
+            change.UnitIndex = it->second;
+        }
+        else if (!TryGetIndex(unit.Identifier(), change.UnitIndex))
+        {
+            throw hresult_invalid_argument(L"The unit of the change data isn't in the table.");
+        }
+
+        change.UnitState = changeData.UnitState();
+        if (auto resultInformation = changeData.ResultInformation())
+        {
+            change.ResultCode = resultInformation.ResultCode();
+            change.ResultSource = resultInformation.ResultSource();
+        }
+
+        return change;
+    }
+
+    void ConfigurationUnitTable::BuildLookups()
+    {
+        for (uint32_t i = 0; i < m_units.size(); i++)
+        {
+            auto const& unit = m_units[i];
+            if (!unit)
+            {
+                throw hresult_invalid_argument(L"The units can't be null.");
+            }
+
+            // Only the first unit with an identifier is found through it.
+            m_indexesByUnit.emplace(get_abi(unit), i);
+            auto identifier = unit.Identifier();
+            if (!identifier.empty())
+            {
+                m_indexesByIdentifier.emplace(std::move(identifier), i);
+            }
+        }
+    }
+}
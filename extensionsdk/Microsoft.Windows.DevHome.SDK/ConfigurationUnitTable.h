@@ -0,0 +1,37 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include "ConfigurationUnitTable.g.h"
+
+using namespace winrt::Windows::Foundation::Collections;
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    struct ConfigurationUnitTable : ConfigurationUnitTableT<ConfigurationUnitTable>
+    {
+        ConfigurationUnitTable(array_view<ConfigurationUnit const> units);
+        ConfigurationUnitTable(std::vector<ConfigurationUnit>&& units);
+
+        static winrt::Microsoft::Windows::DevHome::SDK::ConfigurationUnitTable CreateFromUnits(IIterable<ConfigurationUnit> const& units);
+
+        com_array<ConfigurationUnit> Units();
+        uint32_t Size();
+        bool TryGetIndex(hstring const& identifier, uint32_t& index);
+        ConfigurationSetChange CreateChange(ConfigurationSetChangeData const& changeData);
+
+    private:
+        void BuildLookups();
+
+        // The table is immutable, so it doesn't need a lock.
+        std::vector<ConfigurationUnit> m_units;
+        std::unordered_map<void*, uint32_t> m_indexesByUnit;
+        std::unordered_map<hstring, uint32_t> m_indexesByIdentifier;
+    };
+}
+namespace winrt::Microsoft::Windows::DevHome::SDK::factory_implementation
+{
+    struct ConfigurationUnitTable : ConfigurationUnitTableT<ConfigurationUnitTable, implementation::ConfigurationUnitTable>
+    {
+    };
+}
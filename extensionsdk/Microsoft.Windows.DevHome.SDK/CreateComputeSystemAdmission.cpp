@@ -0,0 +1,110 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "CreateComputeSystemAdmission.h"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    CreateComputeSystemAdmission::CreateComputeSystemAdmission(uint32_t maxConcurrentCreations, uint64_t memoryBudgetInBytes, uint64_t diskBandwidthBudgetInBytesPerSecond) :
+        m_maxConcurrentCreations(maxConcurrentCreations),
+        m_memoryBudgetInBytes(memoryBudgetInBytes),
+        m_diskBandwidthBudgetInBytesPerSecond(diskBandwidthBudgetInBytesPerSecond)
+    {
+    }
+
+    uint32_t CreateComputeSystemAdmission::MaxConcurrentCreations() const
+    {
+        return m_maxConcurrentCreations;
+    }
+
+    uint64_t CreateComputeSystemAdmission::MemoryBudgetInBytes() const
+    {
+        return m_memoryBudgetInBytes;
+    }
+
+    uint64_t CreateComputeSystemAdmission::DiskBandwidthBudgetInBytesPerSecond() const
+    {
+        return m_diskBandwidthBudgetInBytesPerSecond;
+    }
+
+    uint64_t CreateComputeSystemAdmission::Enter(uint64_t memoryInBytes, uint64_t diskBandwidthInBytesPerSecond)
+    {
+        auto id = m_nextId++;
+        m_waiting.push_back(Creation{ id, memoryInBytes, diskBandwidthInBytesPerSecond, 0 });
+        return id;
+    }
+
+    bool CreateComputeSystemAdmission::Leave(uint64_t id)
+    {
+        if (auto it = m_active.find(id); it != m_active.end())
+        {
+            m_memoryInUse -= it->second.memoryInBytes;
+            m_diskBandwidthInUse -= it->second.diskBandwidthInBytesPerSecond;
+            m_active.erase(it);
+            return true;
+        }
+
+        auto it = std::find_if(m_waiting.begin(), m_waiting.end(), [id](Creation const& creation) { return creation.id == id; });
+        if (it == m_waiting.end())
+        {
+            return false;
+        }
+
+        m_waiting.erase(it);
+        return true;
+    }
+
+    void CreateComputeSystemAdmission::AdmitWaiting(std::vector<uint64_t>& admittedIds, std::vector<std::pair<uint64_t, uint32_t>>& changedPositions)
+    {
+        while (!m_waiting.empty() && Fits(m_waiting.front()))
+        {
+            auto const& creation = m_waiting.front();
+            m_memoryInUse += creation.memoryInBytes;
+            m_diskBandwidthInUse += creation.diskBandwidthInBytesPerSecond;
+            admittedIds.push_back(creation.id);
+            m_active.emplace(creation.id, creation);
+            m_waiting.pop_front();
+        }
+
+        uint32_t position = 1;
+        for (auto& creation : m_waiting)
+        {
+            if (creation.reportedPosition != position)
+            {
+                creation.reportedPosition = position;
+                changedPositions.emplace_back(creation.id, position);
+            }
+
+            position++;
+        }
+    }
+
+    uint32_t CreateComputeSystemAdmission::ActiveCreations() const
+    {
+        return static_cast<uint32_t>(m_active.size());
+    }
+
+    size_t CreateComputeSystemAdmission::WaitingCreations() const
+    {
+        return m_waiting.size();
+    }
+
+    // Compares against the remaining budgets instead of adding to the amounts in use, which could overflow. The
+    // amounts in use exceed a budget while a creation larger than the budget runs alone.
+    bool CreateComputeSystemAdmission::Fits(Creation const& creation) const
+    {
+        if (m_active.empty())
+        {
+            return true;
+        }
+
+        auto fitsBudget = [](uint64_t budget, uint64_t inUse, uint64_t requested) {
+            return budget == 0 || (inUse <= budget && requested <= budget - inUse);
+        };
+
+        return m_active.size() < m_maxConcurrentCreations &&
+            fitsBudget(m_memoryBudgetInBytes, m_memoryInUse, creation.memoryInBytes) &&
+            fitsBudget(m_diskBandwidthBudgetInBytesPerSecond, m_diskBandwidthInUse, creation.diskBandwidthInBytesPerSecond);
+    }
+}
@@ -0,0 +1,59 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    // Decides when the creations queued in a CreateComputeSystemQueue start. Creations are admitted in the order
+    // they entered, while fewer than the maximum number of creations are active and the memory and disk bandwidth
+    // of the active creations stay within their budgets; a budget of 0 is unlimited. A creation that doesn't fit
+    // makes the ones behind it wait as well, so a large creation isn't starved by smaller ones. A creation is
+    // always admitted when no other creation is active, even if it is larger than a budget. Creations are referred
+    // to by the id Enter returns. This code only depends on the C++ standard library, so it can be tested and
+    // benchmarked on any platform. The class is not thread safe.
+    class CreateComputeSystemAdmission
+    {
+    public:
+        // maxConcurrentCreations must be at least 1.
+        CreateComputeSystemAdmission(uint32_t maxConcurrentCreations, uint64_t memoryBudgetInBytes, uint64_t diskBandwidthBudgetInBytesPerSecond);
+
+        uint32_t MaxConcurrentCreations() const;
+        uint64_t MemoryBudgetInBytes() const;
+        uint64_t DiskBandwidthBudgetInBytesPerSecond() const;
+
+        // Adds a creation at the end of the queue. It is only admitted by the next call to AdmitWaiting.
+        uint64_t Enter(uint64_t memoryInBytes, uint64_t diskBandwidthInBytesPerSecond);
+
+        // Called when a creation completes, fails or is cancelled, whether or not it was admitted. Returns false
+        // when the creation already left.
+        bool Leave(uint64_t id);
+
+        // Admits waiting creations and adds their ids to admittedIds. Then adds the id and the 1-based position of
+        // every waiting creation whose position changed since it was last reported to changedPositions.
+        void AdmitWaiting(std::vector<uint64_t>& admittedIds, std::vector<std::pair<uint64_t, uint32_t>>& changedPositions);
+
+        uint32_t ActiveCreations() const;
+        size_t WaitingCreations() const;
+
+    private:
+        struct Creation
+        {
+            uint64_t id;
+            uint64_t memoryInBytes;
+            uint64_t diskBandwidthInBytesPerSecond;
+            uint32_t reportedPosition;
+        };
+
+        bool Fits(Creation const& creation) const;
+
+        uint32_t m_maxConcurrentCreations;
+        uint64_t m_memoryBudgetInBytes;
+        uint64_t m_diskBandwidthBudgetInBytesPerSecond;
+        uint64_t m_memoryInUse{ 0 };
+        uint64_t m_diskBandwidthInUse{ 0 };
+        uint64_t m_nextId{ 1 };
+        std::deque<Creation> m_waiting;
+        std::unordered_map<uint64_t, Creation> m_active;
+    };
+}
@@ -5,7 +5,12 @@
 namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
 {
     CreateComputeSystemProgressEventArgs::CreateComputeSystemProgressEventArgs(hstring const& operationStatus, uint32_t percentageCompleted) :
-        m_status(operationStatus), m_percentageCompleted(percentageCompleted)
+        m_status(operationStatus), m_percentageCompleted(percentageCompleted), m_queuePosition(0)
+    {
+    }
+
+    CreateComputeSystemProgressEventArgs::CreateComputeSystemProgressEventArgs(hstring const& operationStatus, uint32_t percentageCompleted, uint32_t queuePosition) :
+        m_status(operationStatus), m_percentageCompleted(percentageCompleted), m_queuePosition(queuePosition)
     {
     }
 
@@ -18,4 +23,9 @@ namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
     {
         return m_percentageCompleted;
     }
+
+    uint32_t CreateComputeSystemProgressEventArgs::QueuePosition()
+    {
+        return m_queuePosition;
+    }
 }
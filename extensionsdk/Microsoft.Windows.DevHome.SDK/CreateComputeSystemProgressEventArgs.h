@@ -6,13 +6,16 @@ namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
     struct CreateComputeSystemProgressEventArgs : CreateComputeSystemProgressEventArgsT<CreateComputeSystemProgressEventArgs>
     {
         CreateComputeSystemProgressEventArgs(hstring const& operationStatus, uint32_t percentageCompleted);
+        CreateComputeSystemProgressEventArgs(hstring const& operationStatus, uint32_t percentageCompleted, uint32_t queuePosition);
 
         hstring Status();
         uint32_t PercentageCompleted();
+        uint32_t QueuePosition();
 
     private:
         hstring m_status;
         uint32_t m_percentageCompleted;
+        uint32_t m_queuePosition;
     };
 }
 namespace winrt::Microsoft::Windows::DevHome::SDK::factory_implementation
@@ -0,0 +1,65 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "CreateComputeSystemProgressReporter.h"
+#include "CreateComputeSystemProgressReporter.g.cpp"
+#include "CreateComputeSystemProgressEventArgs.h"
+
+namespace Projection = winrt::Microsoft::Windows::DevHome::SDK;
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    CreateComputeSystemProgressReporter::CreateComputeSystemProgressReporter(TimeSpan const& minimumInterval) :
+        m_minimumInterval(minimumInterval)
+    {
+        if (minimumInterval < TimeSpan::zero())
+        {
+            throw hresult_invalid_argument(L"minimumInterval parameter should not be negative.");
+        }
+    }
+
+    TimeSpan CreateComputeSystemProgressReporter::MinimumInterval()
+    {
+        return m_minimumInterval;
+    }
+
+    Projection::CreateComputeSystemProgressEventArgs CreateComputeSystemProgressReporter::Report(hstring const& operationStatus, uint32_t percentageCompleted)
+    {
+        auto now = std::chrono::steady_clock::now();
+        std::lock_guard lock(m_mutex);
+
+        // Keep the string that was already delivered, so an unchanged status doesn't hold on to a new copy.
+        auto isNewStatus = !m_deliveryTime || operationStatus != m_deliveredStatus;
+        m_status = isNewStatus ? operationStatus : m_deliveredStatus;
+        m_percentageCompleted = percentageCompleted;
+        m_isPending = isNewStatus || percentageCompleted != m_deliveredPercentageCompleted;
+        if (!m_isPending)
+        {
+            return nullptr;
+        }
+
+        auto isCompleted = percentageCompleted >= 100;
+        if (isNewStatus || isCompleted || now - *m_deliveryTime >= m_minimumInterval)
+        {
+            return Deliver(now);
+        }
+
+        return nullptr;
+    }
+
+    Projection::CreateComputeSystemProgressEventArgs CreateComputeSystemProgressReporter::Flush()
+    {
+        std::lock_guard lock(m_mutex);
+        return m_isPending ? Deliver(std::chrono::steady_clock::now()) : nullptr;
+    }
+
+    Projection::CreateComputeSystemProgressEventArgs CreateComputeSystemProgressReporter::Deliver(std::chrono::steady_clock::time_point now)
+    {
+        m_isPending = false;
+        m_deliveredStatus = m_status;
+        m_deliveredPercentageCompleted = m_percentageCompleted;
+        m_deliveryTime = now;
+        return make<CreateComputeSystemProgressEventArgs>(m_status, m_percentageCompleted);
+    }
+}
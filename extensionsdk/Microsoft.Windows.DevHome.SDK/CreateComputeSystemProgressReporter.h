@@ -0,0 +1,42 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include "CreateComputeSystemProgressReporter.g.h"
+
+using namespace winrt::Windows::Foundation;
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    struct CreateComputeSystemProgressReporter : CreateComputeSystemProgressReporterT<CreateComputeSystemProgressReporter>
+    {
+        CreateComputeSystemProgressReporter(TimeSpan const& minimumInterval);
+
+        TimeSpan MinimumInterval();
+        winrt::Microsoft::Windows::DevHome::SDK::CreateComputeSystemProgressEventArgs Report(hstring const& operationStatus, uint32_t percentageCompleted);
+        winrt::Microsoft::Windows::DevHome::SDK::CreateComputeSystemProgressEventArgs Flush();
+
+    private:
+        // Must be called with m_mutex held.
+        winrt::Microsoft::Windows::DevHome::SDK::CreateComputeSystemProgressEventArgs Deliver(std::chrono::steady_clock::time_point now);
+
+        std::mutex m_mutex;
+        TimeSpan m_minimumInterval;
+
+        // The latest update passed to Report.
+        hstring m_status;
+        uint32_t m_percentageCompleted{ 0 };
+        bool m_isPending{ false };
+
+        // The last update that was delivered.
+        hstring m_deliveredStatus;
+        uint32_t m_deliveredPercentageCompleted{ 0 };
+        std::optional<std::chrono::steady_clock::time_point> m_deliveryTime;
+    };
+}
+namespace winrt::Microsoft::Windows::DevHome::SDK::factory_implementation
+{
+    struct CreateComputeSystemProgressReporter : CreateComputeSystemProgressReporterT<CreateComputeSystemProgressReporter, implementation::CreateComputeSystemProgressReporter>
+    {
+    };
+}
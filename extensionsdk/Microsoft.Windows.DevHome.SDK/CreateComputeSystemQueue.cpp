@@ -0,0 +1,253 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "CreateComputeSystemQueue.h"
+#include "CreateComputeSystemQueue.g.cpp"
+#include "CreateComputeSystemAdmission.h"
+#include "CreateComputeSystemProgressEventArgs.h"
+
+using namespace winrt::Windows::Foundation;
+namespace Projection = winrt::Microsoft::Windows::DevHome::SDK;
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    namespace
+    {
+        struct QueueEntry
+        {
+            // Set once the entry entered the queue.
+            uint64_t id{ 0 };
+            winrt::handle admittedEvent{ CreateEventW(nullptr, TRUE, FALSE, nullptr) };
+
+            // Raises the Progress event of the queued operation. Called outside of the lock.
+            std::function<void(uint32_t)> reportQueuePosition;
+        };
+    }
+
+    struct CreateComputeSystemQueueState
+    {
+        CreateComputeSystemQueueState(uint32_t maxConcurrentCreations, uint64_t memoryBudgetInBytes, uint64_t diskBandwidthBudgetInBytesPerSecond) :
+            admission(maxConcurrentCreations, memoryBudgetInBytes, diskBandwidthBudgetInBytesPerSecond)
+        {
+        }
+
+        std::mutex mutex;
+        CreateComputeSystemAdmission admission;
+
+        // The entries that are waiting or admitted, by id.
+        std::unordered_map<uint64_t, std::shared_ptr<QueueEntry>> entries;
+    };
+
+    namespace
+    {
+        // Signals the entries that were admitted, then reports the new position of every entry whose position
+        // changed.
+        void AdmitWaitingEntries(std::shared_ptr<CreateComputeSystemQueueState> const& state)
+        {
+            std::vector<uint64_t> admittedIds;
+            std::vector<std::pair<uint64_t, uint32_t>> changedPositions;
+            std::vector<std::pair<std::shared_ptr<QueueEntry>, uint32_t>> positionsToReport;
+            {
+                std::lock_guard lock(state->mutex);
+                state->admission.AdmitWaiting(admittedIds, changedPositions);
+                for (auto id : admittedIds)
+                {
+                    SetEvent(state->entries.at(id)->admittedEvent.get());
+                }
+
+                for (auto const& [id, position] : changedPositions)
+                {
+                    positionsToReport.emplace_back(state->entries.at(id), position);
+                }
+            }
+
+            for (auto const& [entry, position] : positionsToReport)
+            {
+                entry->reportQueuePosition(position);
+            }
+        }
+
+        void Enter(std::shared_ptr<CreateComputeSystemQueueState> const& state, std::shared_ptr<QueueEntry> const& entry, uint64_t memoryInBytes, uint64_t diskBandwidthInBytesPerSecond)
+        {
+            {
+                std::lock_guard lock(state->mutex);
+                entry->id = state->admission.Enter(memoryInBytes, diskBandwidthInBytesPerSecond);
+                state->entries.emplace(entry->id, entry);
+            }
+
+            AdmitWaitingEntries(state);
+        }
+
+        // Called when the operation completes, fails or is cancelled, whether or not it was admitted.
+        void Leave(std::shared_ptr<CreateComputeSystemQueueState> const& state, std::shared_ptr<QueueEntry> const& entry)
+        {
+            {
+                std::lock_guard lock(state->mutex);
+                if (!state->admission.Leave(entry->id))
+                {
+                    return;
+                }
+
+                state->entries.erase(entry->id);
+            }
+
+            AdmitWaitingEntries(state);
+        }
+
+        struct LeaveOnExit
+        {
+            std::shared_ptr<CreateComputeSystemQueueState> state;
+            std::shared_ptr<QueueEntry> entry;
+
+            ~LeaveOnExit()
+            {
+                Leave(state, entry);
+            }
+        };
+
+        struct QueuedCreateComputeSystemOperation : winrt::implements<QueuedCreateComputeSystemOperation, ICreateComputeSystemOperation>
+        {
+            QueuedCreateComputeSystemOperation(
+                std::shared_ptr<CreateComputeSystemQueueState> const& state,
+                ICreateComputeSystemOperation const& operation,
+                uint64_t memoryInBytes,
+                uint64_t diskBandwidthInBytesPerSecond,
+                hstring const& queuedStatus) :
+                m_state(state),
+                m_operation(operation),
+                m_memoryInBytes(memoryInBytes),
+                m_diskBandwidthInBytesPerSecond(diskBandwidthInBytesPerSecond),
+                m_queuedStatus(queuedStatus)
+            {
+            }
+
+            winrt::event_token Progress(TypedEventHandler<ICreateComputeSystemOperation, Projection::CreateComputeSystemProgressEventArgs> const& handler)
+            {
+                return m_progress.add(handler);
+            }
+
+            void Progress(winrt::event_token const& token) noexcept
+            {
+                m_progress.remove(token);
+            }
+
+            winrt::event_token ActionRequired(TypedEventHandler<ICreateComputeSystemOperation, Projection::CreateComputeSystemActionRequiredEventArgs> const& handler)
+            {
+                return m_actionRequired.add(handler);
+            }
+
+            void ActionRequired(winrt::event_token const& token) noexcept
+            {
+                m_actionRequired.remove(token);
+            }
+
+            // Throws instead of returning a failed operation, because the second call is a bug in the caller.
+            IAsyncOperation<Projection::CreateComputeSystemResult> StartAsync()
+            {
+                if (m_isStarted.exchange(true))
+                {
+                    throw hresult_illegal_method_call(L"StartAsync can only be called once.");
+                }
+
+                return StartQueuedAsync();
+            }
+
+        private:
+            // Waits in the queue, then starts the wrapped operation. Entering the queue twice would count the
+            // operation twice against the budgets, and the wrapped operation can only be started once as well.
+            IAsyncOperation<Projection::CreateComputeSystemResult> StartQueuedAsync()
+            {
+                auto strongThis = get_strong();
+                auto cancellation = co_await get_cancellation_token();
+                cancellation.enable_propagation();
+
+                auto entry = std::make_shared<QueueEntry>();
+                winrt::check_bool(static_cast<bool>(entry->admittedEvent));
+                entry->reportQueuePosition = [weakThis = get_weak()](uint32_t position) {
+                    // Positions are also reported while another operation leaves the queue, which must not fail
+                    // because of a handler in Dev Home.
+                    try
+                    {
+                        if (auto strongThis = weakThis.get())
+                        {
+                            strongThis->m_progress(*strongThis, make<CreateComputeSystemProgressEventArgs>(strongThis->m_queuedStatus, 0, position));
+                        }
+                    }
+                    catch (hresult_error const&)
+                    {
+                    }
+                };
+
+                // Leaves the queue when the operation completes, fails or is cancelled.
+                LeaveOnExit leaveQueue{ m_state, entry };
+                Enter(m_state, entry, m_memoryInBytes, m_diskBandwidthInBytesPerSecond);
+
+                // Throws when the operation is cancelled while it is waiting.
+                co_await winrt::resume_on_signal(entry->admittedEvent.get());
+
+                auto weakThis = get_weak();
+                m_progressRevoker = m_operation.Progress(winrt::auto_revoke, [weakThis](auto const&, Projection::CreateComputeSystemProgressEventArgs const& args) {
+                    if (auto strongThis = weakThis.get())
+                    {
+                        strongThis->m_progress(*strongThis, args);
+                    }
+                });
+                m_actionRequiredRevoker = m_operation.ActionRequired(winrt::auto_revoke, [weakThis](auto const&, Projection::CreateComputeSystemActionRequiredEventArgs const& args) {
+                    if (auto strongThis = weakThis.get())
+                    {
+                        strongThis->m_actionRequired(*strongThis, args);
+                    }
+                });
+
+                co_return co_await m_operation.StartAsync();
+            }
+
+            std::shared_ptr<CreateComputeSystemQueueState> m_state;
+            ICreateComputeSystemOperation m_operation;
+            uint64_t m_memoryInBytes;
+            uint64_t m_diskBandwidthInBytesPerSecond;
+            hstring m_queuedStatus;
+            winrt::event<TypedEventHandler<ICreateComputeSystemOperation, Projection::CreateComputeSystemProgressEventArgs>> m_progress;
+            winrt::event<TypedEventHandler<ICreateComputeSystemOperation, Projection::CreateComputeSystemActionRequiredEventArgs>> m_actionRequired;
+            ICreateComputeSystemOperation::Progress_revoker m_progressRevoker;
+            ICreateComputeSystemOperation::ActionRequired_revoker m_actionRequiredRevoker;
+            std::atomic<bool> m_isStarted{ false };
+        };
+    }
+
+    CreateComputeSystemQueue::CreateComputeSystemQueue(uint32_t maxConcurrentCreations, uint64_t memoryBudgetInBytes, uint64_t diskBandwidthBudgetInBytesPerSecond)
+    {
+        if (maxConcurrentCreations == 0)
+        {
+            throw hresult_invalid_argument(L"maxConcurrentCreations parameter should be at least 1.");
+        }
+
+        m_state = std::make_shared<CreateComputeSystemQueueState>(maxConcurrentCreations, memoryBudgetInBytes, diskBandwidthBudgetInBytesPerSecond);
+    }
+
+    uint32_t CreateComputeSystemQueue::MaxConcurrentCreations()
+    {
+        return m_state->admission.MaxConcurrentCreations();
+    }
+
+    uint64_t CreateComputeSystemQueue::MemoryBudgetInBytes()
+    {
+        return m_state->admission.MemoryBudgetInBytes();
+    }
+
+    uint64_t CreateComputeSystemQueue::DiskBandwidthBudgetInBytesPerSecond()
+    {
+        return m_state->admission.DiskBandwidthBudgetInBytesPerSecond();
+    }
+
+    ICreateComputeSystemOperation CreateComputeSystemQueue::CreateQueuedOperation(ICreateComputeSystemOperation const& operation, uint64_t memoryInBytes, uint64_t diskBandwidthInBytesPerSecond, hstring const& queuedStatus)
+    {
+        if (!operation)
+        {
+            throw hresult_invalid_argument(L"operation parameter should not be null.");
+        }
+
+        return make<QueuedCreateComputeSystemOperation>(m_state, operation, memoryInBytes, diskBandwidthInBytesPerSecond, queuedStatus);
+    }
+}
@@ -0,0 +1,30 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include "CreateComputeSystemQueue.g.h"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    struct CreateComputeSystemQueueState;
+
+    struct CreateComputeSystemQueue : CreateComputeSystemQueueT<CreateComputeSystemQueue>
+    {
+        CreateComputeSystemQueue(uint32_t maxConcurrentCreations, uint64_t memoryBudgetInBytes, uint64_t diskBandwidthBudgetInBytesPerSecond);
+
+        uint32_t MaxConcurrentCreations();
+        uint64_t MemoryBudgetInBytes();
+        uint64_t DiskBandwidthBudgetInBytesPerSecond();
+        ICreateComputeSystemOperation CreateQueuedOperation(ICreateComputeSystemOperation const& operation, uint64_t memoryInBytes, uint64_t diskBandwidthInBytesPerSecond, hstring const& queuedStatus);
+
+    private:
+        // Shared with the queued operations, which can outlive the queue.
+        std::shared_ptr<CreateComputeSystemQueueState> m_state;
+    };
+}
+namespace winrt::Microsoft::Windows::DevHome::SDK::factory_implementation
+{
+    struct CreateComputeSystemQueue : CreateComputeSystemQueueT<CreateComputeSystemQueue, implementation::CreateComputeSystemQueue>
+    {
+    };
+}
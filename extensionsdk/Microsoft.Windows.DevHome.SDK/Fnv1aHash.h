@@ -0,0 +1,81 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    // 64-bit FNV-1a, used for content hashes and checksums that only have to tell data apart, not resist
+    // tampering. Values wider than a byte are added in little endian order, so a hash doesn't depend on the
+    // machine that computed it. The class is not thread safe.
+    class Fnv1aHash
+    {
+    public:
+        void AddByte(uint8_t value)
+        {
+            m_hash ^= value;
+            m_hash *= Prime;
+        }
+
+        void AddBytes(uint8_t const* data, size_t size)
+        {
+            for (size_t i = 0; i < size; i++)
+            {
+                AddByte(data[i]);
+            }
+        }
+
+        void AddUInt64(uint64_t value)
+        {
+            for (size_t i = 0; i < sizeof(value); i++)
+            {
+                AddByte(static_cast<uint8_t>(value >> (i * 8)));
+            }
+        }
+
+        // Adds the UTF-16 code units of text without its length.
+        void AddCodeUnits(std::wstring_view text)
+        {
+            for (auto codeUnit : text)
+            {
+                AddByte(static_cast<uint8_t>(codeUnit));
+                AddByte(static_cast<uint8_t>(codeUnit >> 8));
+            }
+        }
+
+        // Adds the length of text before its code units, so consecutive strings can't run into each other.
+        void AddString(std::wstring_view text)
+        {
+            AddUInt64(text.size());
+            AddCodeUnits(text);
+        }
+
+        uint64_t Value() const
+        {
+            return m_hash;
+        }
+
+        // The hash as 16 lowercase hexadecimal digits, the format of every content hash in the SDK.
+        std::wstring ToHexString() const
+        {
+            return ToHexString(m_hash);
+        }
+
+        static std::wstring ToHexString(uint64_t hash)
+        {
+            std::wstring text(16, L'0');
+            for (size_t i = 0; i < text.size(); i++)
+            {
+                text[text.size() - 1 - i] = L"0123456789abcdef"[(hash >> (i * 4)) & 0xf];
+            }
+
+            return text;
+        }
+
+    private:
+        static constexpr uint64_t OffsetBasis = 14695981039346656037ull;
+        static constexpr uint64_t Prime = 1099511628211ull;
+
+        uint64_t m_hash{ OffsetBasis };
+    };
+}
@@ -0,0 +1,98 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "OperationTracker.h"
+
+using namespace winrt::Windows::Foundation;
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    // The event is auto-reset, so a change reported while the scheduler is busy wakes it up exactly once more.
+    OperationTracker::OperationTracker(size_t operationCount) :
+        m_changedEvent(CreateEventW(nullptr, FALSE, FALSE, nullptr)),
+        m_operations(operationCount, nullptr),
+        m_isCompleted(operationCount, false)
+    {
+        winrt::check_bool(static_cast<bool>(m_changedEvent));
+    }
+
+    void OperationTracker::Track(size_t index, IAsyncInfo const& operation)
+    {
+        bool isCanceled;
+        {
+            std::lock_guard lock(m_mutex);
+            isCanceled = m_isCanceled || m_isCompleted[index];
+            if (!isCanceled)
+            {
+                m_operations[index] = operation;
+            }
+        }
+
+        if (isCanceled)
+        {
+            operation.Cancel();
+        }
+    }
+
+    void OperationTracker::Complete(size_t index)
+    {
+        {
+            std::lock_guard lock(m_mutex);
+            m_operations[index] = nullptr;
+            m_isCompleted[index] = true;
+        }
+
+        NotifyChanged();
+    }
+
+    void OperationTracker::Cancel(size_t index)
+    {
+        IAsyncInfo operation{ nullptr };
+        {
+            std::lock_guard lock(m_mutex);
+            operation = std::exchange(m_operations[index], nullptr);
+            m_isCompleted[index] = true;
+        }
+
+        if (operation)
+        {
+            operation.Cancel();
+        }
+    }
+
+    // The operations are cancelled outside of the lock because their handlers can run synchronously.
+    void OperationTracker::CancelAll()
+    {
+        std::vector<IAsyncInfo> operations;
+        {
+            std::lock_guard lock(m_mutex);
+            m_isCanceled = true;
+            for (auto& operation : m_operations)
+            {
+                if (operation)
+                {
+                    operations.push_back(std::exchange(operation, nullptr));
+                }
+            }
+        }
+
+        for (auto const& operation : operations)
+        {
+            operation.Cancel();
+        }
+
+        NotifyChanged();
+    }
+
+    bool OperationTracker::IsCanceled()
+    {
+        std::lock_guard lock(m_mutex);
+        return m_isCanceled;
+    }
+
+    void OperationTracker::NotifyChanged()
+    {
+        SetEvent(m_changedEvent.get());
+    }
+}
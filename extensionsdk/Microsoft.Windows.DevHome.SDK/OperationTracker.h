@@ -0,0 +1,49 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    // The part the schedulers of the SDK share: the asynchronous operations they start, indexed by the request
+    // that started them, and the event their handlers signal. Handlers never report to the scheduler directly,
+    // they update the scheduler's state, then call Complete or NotifyChanged, and the scheduler reacts to every
+    // change from its own coroutine after WaitForChange returns. The class is thread safe.
+    class OperationTracker
+    {
+    public:
+        explicit OperationTracker(size_t operationCount);
+
+        // Remembers the operation so that CancelAll can cancel it, or cancels it right away when the scheduler
+        // was cancelled or the request completed while the operation was starting.
+        void Track(size_t index, winrt::Windows::Foundation::IAsyncInfo const& operation);
+
+        // Forgets the operation of a completed request and wakes up the scheduler.
+        void Complete(size_t index);
+
+        // Forgets the operation of a request and cancels it, without waking up the scheduler. Used when the
+        // scheduler gives up on a single request.
+        void Cancel(size_t index);
+
+        // Cancels every tracked operation, including the ones that are tracked later, and wakes up the scheduler.
+        void CancelAll();
+
+        bool IsCanceled();
+
+        void NotifyChanged();
+
+        // Resumes the scheduler once a handler reported a change, or after timeout. A zero timeout waits until
+        // a change is reported. Awaiting it in a cancelled coroutine throws.
+        auto WaitForChange(winrt::Windows::Foundation::TimeSpan timeout = {})
+        {
+            return winrt::resume_on_signal(m_changedEvent.get(), timeout);
+        }
+
+    private:
+        std::mutex m_mutex;
+        winrt::handle m_changedEvent;
+        std::vector<winrt::Windows::Foundation::IAsyncInfo> m_operations;
+        std::vector<bool> m_isCompleted;
+        bool m_isCanceled{ false };
+    };
+}
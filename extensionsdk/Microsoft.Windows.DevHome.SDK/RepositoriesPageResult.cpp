@@ -0,0 +1,51 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "RepositoriesPageResult.h"
+#include "RepositoriesPageResult.g.cpp"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    RepositoriesPageResult::RepositoriesPageResult(IIterable<IRepository> const& repositories, hstring const& continuationToken, uint32_t pageSizeHint) :
+        m_repositories(repositories),
+        m_continuationToken(continuationToken),
+        m_pageSizeHint(pageSizeHint),
+        m_result(ProviderOperationStatus::Success, S_OK, hstring(), hstring())
+    {
+    }
+
+    // A failed page ends the enumeration, so it never carries a continuation token.
+    RepositoriesPageResult::RepositoriesPageResult(winrt::hresult const& e, hstring const& diagnosticText) :
+        m_repositories(nullptr),
+        m_continuationToken(),
+        m_pageSizeHint(0),
+        m_result(ProviderOperationStatus::Failure, e, diagnosticText, diagnosticText)
+    {
+    }
+
+    IIterable<IRepository> RepositoriesPageResult::Repositories()
+    {
+        return m_repositories;
+    }
+
+    hstring RepositoriesPageResult::ContinuationToken()
+    {
+        return m_continuationToken;
+    }
+
+    uint32_t RepositoriesPageResult::PageSizeHint()
+    {
+        return m_pageSizeHint;
+    }
+
+    bool RepositoriesPageResult::HasMorePages()
+    {
+        return !m_continuationToken.empty();
+    }
+
+    ProviderOperationResult RepositoriesPageResult::Result()
+    {
+        return m_result;
+    }
+}
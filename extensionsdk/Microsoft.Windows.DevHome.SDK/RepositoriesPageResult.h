@@ -0,0 +1,34 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include "RepositoriesPageResult.g.h"
+
+using namespace winrt::Windows::Foundation::Collections;
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    struct RepositoriesPageResult : RepositoriesPageResultT<RepositoriesPageResult>
+    {
+        RepositoriesPageResult(IIterable<IRepository> const& repositories, hstring const& continuationToken, uint32_t pageSizeHint);
+        RepositoriesPageResult(winrt::hresult const& e, hstring const& diagnosticText);
+
+        IIterable<IRepository> Repositories();
+        hstring ContinuationToken();
+        uint32_t PageSizeHint();
+        bool HasMorePages();
+        ProviderOperationResult Result();
+
+    private:
+        IIterable<IRepository> m_repositories;
+        hstring m_continuationToken;
+        uint32_t m_pageSizeHint;
+        ProviderOperationResult m_result;
+    };
+}
+namespace winrt::Microsoft::Windows::DevHome::SDK::factory_implementation
+{
+    struct RepositoriesPageResult : RepositoriesPageResultT<RepositoriesPageResult, implementation::RepositoriesPageResult>
+    {
+    };
+}
@@ -0,0 +1,97 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "RepositoryBatchResult.h"
+#include "RepositoryBatchResult.g.cpp"
+#include "RepositoryInfosResult.h"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    RepositoryBatchResult::RepositoryBatchResult(array_view<RepositoryUriEntry const> results, array_view<IRepository const> repositories) :
+        m_results(results.begin(), results.end()),
+        m_repositories(repositories.begin(), repositories.end()),
+        m_result(ProviderOperationStatus::Success, S_OK, hstring(), hstring())
+    {
+        ValidateRepositories();
+    }
+
+    RepositoryBatchResult::RepositoryBatchResult(std::vector<RepositoryUriEntry>&& results, std::vector<IRepository>&& repositories) :
+        m_results(std::move(results)),
+        m_repositories(std::move(repositories)),
+        m_result(ProviderOperationStatus::Success, S_OK, hstring(), hstring())
+    {
+        ValidateRepositories();
+    }
+
+    RepositoryBatchResult::RepositoryBatchResult(winrt::hresult const& e, hstring const& diagnosticText) :
+        m_results(),
+        m_repositories(),
+        m_result(ProviderOperationStatus::Failure, e, diagnosticText, diagnosticText)
+    {
+    }
+
+    winrt::Microsoft::Windows::DevHome::SDK::RepositoryBatchResult RepositoryBatchResult::CreateFromResults(
+        array_view<winrt::Microsoft::Windows::DevHome::SDK::RepositoryResult const> results)
+    {
+        std::vector<RepositoryUriEntry> entries;
+        std::vector<IRepository> repositories;
+        entries.reserve(results.size());
+        repositories.reserve(results.size());
+        for (auto const& result : results)
+        {
+            if (!result)
+            {
+                throw hresult_invalid_argument(L"results parameter should not contain null results.");
+            }
+
+            auto operationResult = result.Result();
+            auto repository = result.Repository();
+            if (operationResult.Status() == ProviderOperationStatus::Success && repository)
+            {
+                entries.push_back(RepositoryUriEntry{ RepositoryInfosResult::ToRepositoryInfo(repository), S_OK, hstring() });
+                repositories.push_back(repository);
+            }
+            else
+            {
+                // Failed results are reported with a failure code, even when the extension didn't set one.
+                winrt::hresult error = operationResult.ExtendedError();
+                entries.push_back(RepositoryUriEntry{ RepositoryInfo{}, (error < 0) ? error : winrt::hresult{ E_FAIL }, operationResult.DiagnosticText() });
+                repositories.push_back(nullptr);
+            }
+        }
+
+        return make<RepositoryBatchResult>(std::move(entries), std::move(repositories));
+    }
+
+    com_array<RepositoryUriEntry> RepositoryBatchResult::Results()
+    {
+        return com_array<RepositoryUriEntry>(m_results.begin(), m_results.end());
+    }
+
+    com_array<IRepository> RepositoryBatchResult::Repositories()
+    {
+        return com_array<IRepository>(m_repositories.begin(), m_repositories.end());
+    }
+
+    ProviderOperationResult RepositoryBatchResult::Result()
+    {
+        return m_result;
+    }
+
+    void RepositoryBatchResult::ValidateRepositories()
+    {
+        if (m_repositories.size() != m_results.size())
+        {
+            throw hresult_invalid_argument(L"repositories parameter should have one repository per result.");
+        }
+
+        for (size_t i = 0; i < m_results.size(); i++)
+        {
+            if ((m_results[i].Error >= 0) && !m_repositories[i])
+            {
+                throw hresult_invalid_argument(L"repositories parameter should not contain null repositories for successful results.");
+            }
+        }
+    }
+}
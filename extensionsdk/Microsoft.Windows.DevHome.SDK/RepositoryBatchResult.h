@@ -0,0 +1,35 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include "RepositoryBatchResult.g.h"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    struct RepositoryBatchResult : RepositoryBatchResultT<RepositoryBatchResult>
+    {
+        RepositoryBatchResult(array_view<RepositoryUriEntry const> results, array_view<IRepository const> repositories);
+        RepositoryBatchResult(std::vector<RepositoryUriEntry>&& results, std::vector<IRepository>&& repositories);
+        RepositoryBatchResult(winrt::hresult const& e, hstring const& diagnosticText);
+
+        static winrt::Microsoft::Windows::DevHome::SDK::RepositoryBatchResult CreateFromResults(
+            array_view<winrt::Microsoft::Windows::DevHome::SDK::RepositoryResult const> results);
+
+        com_array<RepositoryUriEntry> Results();
+        com_array<IRepository> Repositories();
+        ProviderOperationResult Result();
+
+    private:
+        void ValidateRepositories();
+
+        std::vector<RepositoryUriEntry> m_results;
+        std::vector<IRepository> m_repositories;
+        ProviderOperationResult m_result;
+    };
+}
+namespace winrt::Microsoft::Windows::DevHome::SDK::factory_implementation
+{
+    struct RepositoryBatchResult : RepositoryBatchResultT<RepositoryBatchResult, implementation::RepositoryBatchResult>
+    {
+    };
+}
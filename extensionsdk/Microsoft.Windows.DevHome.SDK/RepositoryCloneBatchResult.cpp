@@ -0,0 +1,31 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "RepositoryCloneBatchResult.h"
+#include "RepositoryCloneBatchResult.g.cpp"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    RepositoryCloneBatchResult::RepositoryCloneBatchResult(array_view<winrt::Microsoft::Windows::DevHome::SDK::ProviderOperationResult const> results) :
+        m_results(results.begin(), results.end()),
+        m_result(ProviderOperationStatus::Success, S_OK, hstring(), hstring())
+    {
+    }
+
+    RepositoryCloneBatchResult::RepositoryCloneBatchResult(winrt::hresult const& e, hstring const& diagnosticText) :
+        m_results(),
+        m_result(ProviderOperationStatus::Failure, e, diagnosticText, diagnosticText)
+    {
+    }
+
+    com_array<winrt::Microsoft::Windows::DevHome::SDK::ProviderOperationResult> RepositoryCloneBatchResult::Results()
+    {
+        return com_array<winrt::Microsoft::Windows::DevHome::SDK::ProviderOperationResult>(m_results.begin(), m_results.end());
+    }
+
+    winrt::Microsoft::Windows::DevHome::SDK::ProviderOperationResult RepositoryCloneBatchResult::Result()
+    {
+        return m_result;
+    }
+}
@@ -0,0 +1,27 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include "RepositoryCloneBatchResult.g.h"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    struct RepositoryCloneBatchResult : RepositoryCloneBatchResultT<RepositoryCloneBatchResult>
+    {
+        RepositoryCloneBatchResult(array_view<winrt::Microsoft::Windows::DevHome::SDK::ProviderOperationResult const> results);
+        RepositoryCloneBatchResult(winrt::hresult const& e, hstring const& diagnosticText);
+
+        com_array<winrt::Microsoft::Windows::DevHome::SDK::ProviderOperationResult> Results();
+        winrt::Microsoft::Windows::DevHome::SDK::ProviderOperationResult Result();
+
+    private:
+        std::vector<winrt::Microsoft::Windows::DevHome::SDK::ProviderOperationResult> m_results;
+        winrt::Microsoft::Windows::DevHome::SDK::ProviderOperationResult m_result;
+    };
+}
+namespace winrt::Microsoft::Windows::DevHome::SDK::factory_implementation
+{
+    struct RepositoryCloneBatchResult : RepositoryCloneBatchResultT<RepositoryCloneBatchResult, implementation::RepositoryCloneBatchResult>
+    {
+    };
+}
@@ -0,0 +1,34 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "RepositoryCloneRequest.h"
+#include "RepositoryCloneRequest.g.cpp"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    RepositoryCloneRequest::RepositoryCloneRequest(IRepositoryProvider const& provider, IRepository const& repository, hstring const& cloneDestination, IDeveloperId const& developerId) :
+        m_provider(provider), m_repository(repository), m_cloneDestination(cloneDestination), m_developerId(developerId)
+    {
+    }
+
+    IRepositoryProvider RepositoryCloneRequest::Provider()
+    {
+        return m_provider;
+    }
+
+    IRepository RepositoryCloneRequest::Repository()
+    {
+        return m_repository;
+    }
+
+    hstring RepositoryCloneRequest::CloneDestination()
+    {
+        return m_cloneDestination;
+    }
+
+    IDeveloperId RepositoryCloneRequest::DeveloperId()
+    {
+        return m_developerId;
+    }
+}
@@ -0,0 +1,30 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include "RepositoryCloneRequest.g.h"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    struct RepositoryCloneRequest : RepositoryCloneRequestT<RepositoryCloneRequest>
+    {
+        RepositoryCloneRequest(IRepositoryProvider const& provider, IRepository const& repository, hstring const& cloneDestination, IDeveloperId const& developerId);
+
+        IRepositoryProvider Provider();
+        IRepository Repository();
+        hstring CloneDestination();
+        IDeveloperId DeveloperId();
+
+    private:
+        IRepositoryProvider m_provider;
+        IRepository m_repository;
+        hstring m_cloneDestination;
+        IDeveloperId m_developerId;
+    };
+}
+namespace winrt::Microsoft::Windows::DevHome::SDK::factory_implementation
+{
+    struct RepositoryCloneRequest : RepositoryCloneRequestT<RepositoryCloneRequest, implementation::RepositoryCloneRequest>
+    {
+    };
+}
@@ -0,0 +1,274 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "RepositoryCloneScheduler.h"
+#include "RepositoryCloneScheduler.g.cpp"
+#include "RepositoryCloneBatchResult.h"
+#include "OperationTracker.h"
+
+namespace Projection = winrt::Microsoft::Windows::DevHome::SDK;
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    namespace
+    {
+        struct HostQueue
+        {
+            std::wstring host;
+            std::deque<uint32_t> pendingRequests;
+            uint32_t activeClones{ 0 };
+        };
+
+        // Shared between the batch and the completion and progress handlers of the clones.
+        struct CloneBatchState
+        {
+            explicit CloneBatchState(uint32_t requestCount) :
+                operations(requestCount), requestHosts(requestCount), results(requestCount, nullptr), latestProgress(requestCount)
+            {
+            }
+
+            OperationTracker operations;
+            std::mutex mutex;
+            std::vector<HostQueue> hosts;
+            size_t nextHost{ 0 };
+            std::vector<size_t> requestHosts;
+            std::vector<Projection::ProviderOperationResult> results;
+            std::vector<RepositoryCloneProgress> latestProgress;
+            std::vector<uint32_t> changedRequests;
+            uint32_t activeClones{ 0 };
+            uint32_t completedClones{ 0 };
+        };
+
+        // Hosts are lowercased with the invariant locale, so requests are grouped the same way whatever the
+        // locale of the process is.
+        std::wstring GetHost(Projection::RepositoryCloneRequest const& request)
+        {
+            auto repository = request.Repository();
+            auto repoUri = repository ? repository.RepoUri() : nullptr;
+            std::wstring host{ repoUri ? repoUri.Host() : hstring() };
+            if (!host.empty())
+            {
+                LCMapStringEx(LOCALE_NAME_INVARIANT, LCMAP_LOWERCASE, host.data(), static_cast<int>(host.size()), host.data(), static_cast<int>(host.size()), nullptr, nullptr, 0);
+            }
+
+            return host;
+        }
+
+        Projection::ProviderOperationResult CreateFailureResult(winrt::hresult const& e, hstring const& diagnosticText)
+        {
+            return Projection::ProviderOperationResult(ProviderOperationStatus::Failure, e, diagnosticText, diagnosticText);
+        }
+
+        template <typename TOperation>
+        Projection::ProviderOperationResult GetCloneResult(TOperation const& operation, AsyncStatus status)
+        {
+            try
+            {
+                if (status == AsyncStatus::Canceled)
+                {
+                    return CreateFailureResult(HRESULT_FROM_WIN32(ERROR_CANCELLED), L"The clone was cancelled.");
+                }
+
+                return operation.GetResults();
+            }
+            catch (hresult_error const& error)
+            {
+                return CreateFailureResult(error.code(), error.message());
+            }
+        }
+
+        // Picks the next request from the hosts in turn, skipping hosts that are at their limit.
+        std::optional<uint32_t> TryTakeNextRequest(CloneBatchState& state, uint32_t maxConcurrentClonesPerHost)
+        {
+            for (size_t i = 0; i < state.hosts.size(); i++)
+            {
+                auto hostIndex = (state.nextHost + i) % state.hosts.size();
+                auto& host = state.hosts[hostIndex];
+                if (host.pendingRequests.empty() || (maxConcurrentClonesPerHost != 0 && host.activeClones >= maxConcurrentClonesPerHost))
+                {
+                    continue;
+                }
+
+                auto request = host.pendingRequests.front();
+                host.pendingRequests.pop_front();
+                host.activeClones++;
+                state.activeClones++;
+                state.nextHost = hostIndex + 1;
+                return request;
+            }
+
+            return std::nullopt;
+        }
+
+        void ReportProgress(std::shared_ptr<CloneBatchState> const& state, uint32_t requestIndex, RepositoryCloneProgress const& progress)
+        {
+            {
+                std::lock_guard lock(state->mutex);
+                state->latestProgress[requestIndex] = progress;
+                if (std::find(state->changedRequests.begin(), state->changedRequests.end(), requestIndex) == state->changedRequests.end())
+                {
+                    state->changedRequests.push_back(requestIndex);
+                }
+            }
+
+            state->operations.NotifyChanged();
+        }
+
+        void CompleteClone(std::shared_ptr<CloneBatchState> const& state, uint32_t requestIndex, Projection::ProviderOperationResult const& result)
+        {
+            {
+                std::lock_guard lock(state->mutex);
+                if (state->results[requestIndex])
+                {
+                    return;
+                }
+
+                state->results[requestIndex] = result;
+                state->hosts[state->requestHosts[requestIndex]].activeClones--;
+                state->activeClones--;
+                state->completedClones++;
+                if (std::find(state->changedRequests.begin(), state->changedRequests.end(), requestIndex) == state->changedRequests.end())
+                {
+                    state->changedRequests.push_back(requestIndex);
+                }
+            }
+
+            state->operations.Complete(requestIndex);
+        }
+
+        void StartClone(std::shared_ptr<CloneBatchState> const& state, Projection::RepositoryCloneRequest const& request, uint32_t requestIndex)
+        {
+            try
+            {
+                auto provider = request.Provider();
+                auto repository = request.Repository();
+                auto cloneDestination = request.CloneDestination();
+                auto developerId = request.DeveloperId();
+                if (auto provider3 = provider.try_as<IRepositoryProvider3>())
+                {
+                    auto operation = provider3.CloneRepositoryWithProgressAsync(repository, cloneDestination, developerId);
+                    state->operations.Track(requestIndex, operation);
+                    operation.Progress([state, requestIndex](auto const&, RepositoryCloneProgress const& progress) {
+                        ReportProgress(state, requestIndex, progress);
+                    });
+                    operation.Completed([state, requestIndex](auto const& sender, AsyncStatus status) {
+                        CompleteClone(state, requestIndex, GetCloneResult(sender, status));
+                    });
+                }
+                else
+                {
+                    auto operation = developerId ?
+                        provider.CloneRepositoryAsync(repository, cloneDestination, developerId) :
+                        provider.CloneRepositoryAsync(repository, cloneDestination);
+                    state->operations.Track(requestIndex, operation);
+                    operation.Completed([state, requestIndex](auto const& sender, AsyncStatus status) {
+                        CompleteClone(state, requestIndex, GetCloneResult(sender, status));
+                    });
+                }
+            }
+            catch (hresult_error const& error)
+            {
+                CompleteClone(state, requestIndex, CreateFailureResult(error.code(), error.message()));
+            }
+        }
+    }
+
+    RepositoryCloneScheduler::RepositoryCloneScheduler(uint32_t maxConcurrentClones, uint32_t maxConcurrentClonesPerHost) :
+        m_maxConcurrentClones(maxConcurrentClones), m_maxConcurrentClonesPerHost(maxConcurrentClonesPerHost)
+    {
+        if (maxConcurrentClones == 0)
+        {
+            throw hresult_invalid_argument(L"maxConcurrentClones parameter should be at least 1.");
+        }
+    }
+
+    uint32_t RepositoryCloneScheduler::MaxConcurrentClones()
+    {
+        return m_maxConcurrentClones;
+    }
+
+    uint32_t RepositoryCloneScheduler::MaxConcurrentClonesPerHost()
+    {
+        return m_maxConcurrentClonesPerHost;
+    }
+
+    IAsyncOperationWithProgress<Projection::RepositoryCloneBatchResult, RepositoryCloneBatchProgress> RepositoryCloneScheduler::CloneRepositoriesAsync(
+        array_view<Projection::RepositoryCloneRequest const> requests)
+    {
+        // The array_view refers to the caller's memory, so it has to be copied before the first suspension.
+        std::vector<Projection::RepositoryCloneRequest> cloneRequests{ requests.begin(), requests.end() };
+        auto strongThis = get_strong();
+        auto cancellation = co_await get_cancellation_token();
+        auto progress = co_await get_progress_token();
+
+        auto totalCount = static_cast<uint32_t>(cloneRequests.size());
+        auto state = std::make_shared<CloneBatchState>(totalCount);
+        for (uint32_t requestIndex = 0; requestIndex < totalCount; requestIndex++)
+        {
+            auto host = GetHost(cloneRequests[requestIndex]);
+            auto it = std::find_if(state->hosts.begin(), state->hosts.end(), [&host](HostQueue const& hostQueue) { return hostQueue.host == host; });
+            if (it == state->hosts.end())
+            {
+                it = state->hosts.insert(state->hosts.end(), HostQueue{ std::move(host) });
+            }
+
+            it->pendingRequests.push_back(requestIndex);
+            state->requestHosts[requestIndex] = static_cast<size_t>(it - state->hosts.begin());
+        }
+
+        cancellation.callback([state]() {
+            state->operations.CancelAll();
+        });
+
+        while (true)
+        {
+            std::vector<uint32_t> requestsToStart;
+            std::vector<RepositoryCloneBatchProgress> progressToReport;
+            bool isCompleted;
+            auto isCanceled = state->operations.IsCanceled();
+            {
+                std::lock_guard lock(state->mutex);
+                while (!isCanceled && state->activeClones < m_maxConcurrentClones)
+                {
+                    auto requestIndex = TryTakeNextRequest(*state, m_maxConcurrentClonesPerHost);
+                    if (!requestIndex)
+                    {
+                        break;
+                    }
+
+                    requestsToStart.push_back(*requestIndex);
+                }
+
+                for (auto requestIndex : state->changedRequests)
+                {
+                    progressToReport.push_back(RepositoryCloneBatchProgress{ requestIndex, state->latestProgress[requestIndex], state->completedClones, totalCount });
+                }
+
+                state->changedRequests.clear();
+                isCompleted = state->completedClones == totalCount;
+            }
+
+            for (auto const& batchProgress : progressToReport)
+            {
+                progress(batchProgress);
+            }
+
+            // Providers are called outside of the lock because a clone can complete synchronously.
+            for (auto requestIndex : requestsToStart)
+            {
+                StartClone(state, cloneRequests[requestIndex], requestIndex);
+            }
+
+            if (isCompleted)
+            {
+                break;
+            }
+
+            // Throws when the batch is cancelled.
+            co_await state->operations.WaitForChange();
+        }
+
+        co_return make<RepositoryCloneBatchResult>(state->results);
+    }
+}
@@ -0,0 +1,30 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include "RepositoryCloneScheduler.g.h"
+
+using namespace winrt::Windows::Foundation;
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    struct RepositoryCloneScheduler : RepositoryCloneSchedulerT<RepositoryCloneScheduler>
+    {
+        RepositoryCloneScheduler(uint32_t maxConcurrentClones, uint32_t maxConcurrentClonesPerHost);
+
+        uint32_t MaxConcurrentClones();
+        uint32_t MaxConcurrentClonesPerHost();
+        IAsyncOperationWithProgress<winrt::Microsoft::Windows::DevHome::SDK::RepositoryCloneBatchResult, RepositoryCloneBatchProgress> CloneRepositoriesAsync(
+            array_view<winrt::Microsoft::Windows::DevHome::SDK::RepositoryCloneRequest const> requests);
+
+    private:
+        uint32_t m_maxConcurrentClones;
+        uint32_t m_maxConcurrentClonesPerHost;
+    };
+}
+namespace winrt::Microsoft::Windows::DevHome::SDK::factory_implementation
+{
+    struct RepositoryCloneScheduler : RepositoryCloneSchedulerT<RepositoryCloneScheduler, implementation::RepositoryCloneScheduler>
+    {
+    };
+}
@@ -0,0 +1,62 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "RepositoryInfosResult.h"
+#include "RepositoryInfosResult.g.cpp"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    RepositoryInfosResult::RepositoryInfosResult(array_view<RepositoryInfo const> repositories) :
+        m_repositories(repositories.begin(), repositories.end()),
+        m_result(ProviderOperationStatus::Success, S_OK, hstring(), hstring())
+    {
+    }
+
+    RepositoryInfosResult::RepositoryInfosResult(std::vector<RepositoryInfo>&& repositories) :
+        m_repositories(std::move(repositories)),
+        m_result(ProviderOperationStatus::Success, S_OK, hstring(), hstring())
+    {
+    }
+
+    RepositoryInfosResult::RepositoryInfosResult(winrt::hresult const& e, hstring const& diagnosticText) :
+        m_repositories(),
+        m_result(ProviderOperationStatus::Failure, e, diagnosticText, diagnosticText)
+    {
+    }
+
+    winrt::Microsoft::Windows::DevHome::SDK::RepositoryInfosResult RepositoryInfosResult::CreateFromRepositories(IIterable<IRepository> const& repositories)
+    {
+        std::vector<RepositoryInfo> repositoryInfos;
+        if (repositories)
+        {
+            for (auto const& repository : repositories)
+            {
+                repositoryInfos.push_back(ToRepositoryInfo(repository));
+            }
+        }
+
+        return make<RepositoryInfosResult>(std::move(repositoryInfos));
+    }
+
+    RepositoryInfo RepositoryInfosResult::ToRepositoryInfo(IRepository const& repository)
+    {
+        auto repoUri = repository.RepoUri();
+        return RepositoryInfo{
+            repository.DisplayName(),
+            repository.OwningAccountName(),
+            repository.IsPrivate(),
+            repository.LastUpdated(),
+            repoUri ? repoUri.AbsoluteUri() : hstring() };
+    }
+
+    com_array<RepositoryInfo> RepositoryInfosResult::Repositories()
+    {
+        return com_array<RepositoryInfo>(m_repositories.begin(), m_repositories.end());
+    }
+
+    ProviderOperationResult RepositoryInfosResult::Result()
+    {
+        return m_result;
+    }
+}
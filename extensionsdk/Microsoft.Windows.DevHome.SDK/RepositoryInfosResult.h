@@ -0,0 +1,35 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include "RepositoryInfosResult.g.h"
+
+using namespace winrt::Windows::Foundation::Collections;
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    struct RepositoryInfosResult : RepositoryInfosResultT<RepositoryInfosResult>
+    {
+        RepositoryInfosResult(array_view<RepositoryInfo const> repositories);
+        RepositoryInfosResult(std::vector<RepositoryInfo>&& repositories);
+        RepositoryInfosResult(winrt::hresult const& e, hstring const& diagnosticText);
+
+        static winrt::Microsoft::Windows::DevHome::SDK::RepositoryInfosResult CreateFromRepositories(IIterable<IRepository> const& repositories);
+
+        // Reads the properties of the repository once. Also used by RepositoryBatchResult.
+        static RepositoryInfo ToRepositoryInfo(IRepository const& repository);
+
+        com_array<RepositoryInfo> Repositories();
+        ProviderOperationResult Result();
+
+    private:
+        std::vector<RepositoryInfo> m_repositories;
+        ProviderOperationResult m_result;
+    };
+}
+namespace winrt::Microsoft::Windows::DevHome::SDK::factory_implementation
+{
+    struct RepositoryInfosResult : RepositoryInfosResultT<RepositoryInfosResult, implementation::RepositoryInfosResult>
+    {
+    };
+}
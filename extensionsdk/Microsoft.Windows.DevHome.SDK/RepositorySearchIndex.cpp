@@ -0,0 +1,95 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "RepositorySearchIndex.h"
+#include "RepositorySearchIndex.g.cpp"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    uint32_t RepositorySearchIndex::Count()
+    {
+        std::shared_lock lock(m_mutex);
+        return static_cast<uint32_t>(m_index.Count());
+    }
+
+    void RepositorySearchIndex::AddOrUpdate(hstring const& id, hstring const& name, hstring const& owner, array_view<hstring const> topics)
+    {
+        std::vector<std::wstring_view> topicValues{ topics.begin(), topics.end() };
+
+        std::unique_lock lock(m_mutex);
+        if (auto it = m_entries.find(id); it != m_entries.end())
+        {
+            m_index.Remove(it->second);
+            m_entries.erase(it);
+        }
+
+        auto entry = m_index.Add(name, owner, topicValues);
+        if (entry >= m_ids.size())
+        {
+            m_ids.resize(entry + 1);
+        }
+
+        m_ids[entry] = id;
+        m_entries.emplace(id, entry);
+    }
+
+    bool RepositorySearchIndex::Remove(hstring const& id)
+    {
+        std::unique_lock lock(m_mutex);
+        auto it = m_entries.find(id);
+        if (it == m_entries.end())
+        {
+            return false;
+        }
+
+        m_index.Remove(it->second);
+        m_ids[it->second] = hstring();
+        m_entries.erase(it);
+        return true;
+    }
+
+    void RepositorySearchIndex::Clear()
+    {
+        std::unique_lock lock(m_mutex);
+        m_index.Clear();
+        m_entries.clear();
+        m_ids.clear();
+    }
+
+    com_array<RepositorySearchMatch> RepositorySearchIndex::Search(hstring const& query, RepositorySearchFields const& fields, uint32_t maxResults)
+    {
+        std::shared_lock lock(m_mutex);
+        auto matches = m_index.Search(query, static_cast<uint32_t>(fields), maxResults);
+
+        std::vector<RepositorySearchMatch> searchMatches;
+        searchMatches.reserve(matches.size());
+        for (auto const& match : matches)
+        {
+            searchMatches.push_back(RepositorySearchMatch{ m_ids[match.entry], match.score });
+        }
+
+        return com_array<RepositorySearchMatch>(searchMatches.begin(), searchMatches.end());
+    }
+
+    com_array<hstring> RepositorySearchIndex::SuggestValues(RepositorySearchFields const& field, hstring const& query, uint32_t maxResults)
+    {
+        auto indexField = static_cast<TrigramIndex::Field>(field);
+        if (indexField != TrigramIndex::Field::Name && indexField != TrigramIndex::Field::Owner && indexField != TrigramIndex::Field::Topics)
+        {
+            throw hresult_invalid_argument(L"field parameter should be a single RepositorySearchFields value.");
+        }
+
+        std::shared_lock lock(m_mutex);
+        auto values = m_index.Suggest(indexField, query, maxResults);
+
+        std::vector<hstring> suggestions;
+        suggestions.reserve(values.size());
+        for (auto const& value : values)
+        {
+            suggestions.emplace_back(value);
+        }
+
+        return com_array<hstring>(suggestions.begin(), suggestions.end());
+    }
+}
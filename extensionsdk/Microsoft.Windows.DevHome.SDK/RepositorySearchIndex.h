@@ -0,0 +1,35 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include "RepositorySearchIndex.g.h"
+#include "TrigramIndex.h"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    struct RepositorySearchIndex : RepositorySearchIndexT<RepositorySearchIndex>
+    {
+        RepositorySearchIndex() = default;
+
+        uint32_t Count();
+        void AddOrUpdate(hstring const& id, hstring const& name, hstring const& owner, array_view<hstring const> topics);
+        bool Remove(hstring const& id);
+        void Clear();
+        com_array<RepositorySearchMatch> Search(hstring const& query, RepositorySearchFields const& fields, uint32_t maxResults);
+        com_array<hstring> SuggestValues(RepositorySearchFields const& field, hstring const& query, uint32_t maxResults);
+
+    private:
+        std::shared_mutex m_mutex;
+        TrigramIndex m_index;
+
+        // Maps repository ids to index entries and back.
+        std::unordered_map<hstring, uint32_t> m_entries;
+        std::vector<hstring> m_ids;
+    };
+}
+namespace winrt::Microsoft::Windows::DevHome::SDK::factory_implementation
+{
+    struct RepositorySearchIndex : RepositorySearchIndexT<RepositorySearchIndex, implementation::RepositorySearchIndex>
+    {
+    };
+}
@@ -0,0 +1,222 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "RepositorySearchSuggestionSession.h"
+#include "RepositorySearchSuggestionSession.g.cpp"
+#include "SearchFieldSuggestionsResult.h"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    namespace
+    {
+        winrt::Microsoft::Windows::DevHome::SDK::SearchFieldSuggestionsResult CreateSupersededResult(uint64_t generation)
+        {
+            return make<SearchFieldSuggestionsResult>(generation, HRESULT_FROM_WIN32(ERROR_CANCELLED), L"The request was superseded by a newer request.");
+        }
+
+        // Changing any other field must not reuse suggestions that were returned for a different query, so the
+        // values of every other field are part of the cache scope.
+        std::wstring GetCacheScope(IMapView<hstring, hstring> const& fieldValues, hstring const& requestedSearchField)
+        {
+            std::vector<std::pair<std::wstring, std::wstring>> otherFields;
+            if (fieldValues)
+            {
+                for (auto const& fieldValue : fieldValues)
+                {
+                    if (fieldValue.Key() != requestedSearchField)
+                    {
+                        otherFields.emplace_back(fieldValue.Key(), fieldValue.Value());
+                    }
+                }
+            }
+
+            return SearchSuggestionCache::GetScope(requestedSearchField, std::move(otherFields));
+        }
+    }
+
+    RepositorySearchSuggestionSession::RepositorySearchSuggestionSession(IRepositoryProvider2 const& provider, IDeveloperId const& developerId) :
+        m_provider(provider),
+        m_developerId(developerId),
+        m_debounceInterval(std::chrono::milliseconds(150)),
+        m_isPrefixFilteringEnabled(true),
+        m_generation(0),
+        m_pendingOperation(nullptr)
+    {
+    }
+
+    TimeSpan RepositorySearchSuggestionSession::DebounceInterval()
+    {
+        std::lock_guard lock(m_mutex);
+        return m_debounceInterval;
+    }
+
+    void RepositorySearchSuggestionSession::DebounceInterval(TimeSpan const& value)
+    {
+        std::lock_guard lock(m_mutex);
+        m_debounceInterval = value;
+    }
+
+    bool RepositorySearchSuggestionSession::IsPrefixFilteringEnabled()
+    {
+        std::lock_guard lock(m_mutex);
+        return m_isPrefixFilteringEnabled;
+    }
+
+    void RepositorySearchSuggestionSession::IsPrefixFilteringEnabled(bool value)
+    {
+        std::lock_guard lock(m_mutex);
+        m_isPrefixFilteringEnabled = value;
+    }
+
+    uint64_t RepositorySearchSuggestionSession::CurrentGeneration()
+    {
+        std::lock_guard lock(m_mutex);
+        return m_generation;
+    }
+
+    IAsyncOperation<winrt::Microsoft::Windows::DevHome::SDK::SearchFieldSuggestionsResult> RepositorySearchSuggestionSession::GetValuesForSearchFieldAsync(IMapView<hstring, hstring> fieldValues, hstring requestedSearchField)
+    {
+        auto strongThis = get_strong();
+        auto cancellation = co_await get_cancellation_token();
+        cancellation.enable_propagation();
+
+        uint64_t generation;
+        TimeSpan debounceInterval;
+        IAsyncInfo previousOperation{ nullptr };
+        {
+            std::lock_guard lock(m_mutex);
+            generation = ++m_generation;
+            debounceInterval = m_debounceInterval;
+            previousOperation = std::exchange(m_pendingOperation, nullptr);
+        }
+
+        // Cancel outside of the lock, the previous request may complete synchronously.
+        if (previousOperation)
+        {
+            previousOperation.Cancel();
+        }
+
+        hstring typedValue;
+        if (fieldValues && fieldValues.HasKey(requestedSearchField))
+        {
+            typedValue = fieldValues.Lookup(requestedSearchField);
+        }
+
+        auto scope = GetCacheScope(fieldValues, requestedSearchField);
+        std::optional<std::vector<std::wstring>> cachedValues;
+        {
+            std::lock_guard lock(m_mutex);
+            cachedValues = m_cache.TryGet(scope, typedValue, m_isPrefixFilteringEnabled);
+        }
+
+        if (cachedValues)
+        {
+            std::vector<hstring> values(cachedValues->begin(), cachedValues->end());
+            co_return make<SearchFieldSuggestionsResult>(generation, winrt::single_threaded_vector<hstring>(std::move(values)).GetView(), true);
+        }
+
+        if (debounceInterval.count() > 0)
+        {
+            co_await winrt::resume_after(debounceInterval);
+        }
+
+        if (!IsCurrentGeneration(generation))
+        {
+            co_return CreateSupersededResult(generation);
+        }
+
+        IAsyncOperation<IVectorView<hstring>> operation{ nullptr };
+        try
+        {
+            operation = m_provider.GetValuesForSearchFieldAsync(fieldValues, requestedSearchField, m_developerId);
+
+            bool isSuperseded;
+            {
+                std::lock_guard lock(m_mutex);
+                isSuperseded = m_generation != generation;
+                if (!isSuperseded)
+                {
+                    m_pendingOperation = operation;
+                }
+            }
+
+            if (isSuperseded)
+            {
+                operation.Cancel();
+                co_return CreateSupersededResult(generation);
+            }
+
+            auto providerValues = co_await operation;
+            ClearPendingOperation(operation);
+
+            std::vector<hstring> values;
+            if (providerValues)
+            {
+                values.reserve(providerValues.Size());
+                for (auto const& value : providerValues)
+                {
+                    values.push_back(value);
+                }
+            }
+
+            // The answer is still valid for later requests even when this one was superseded.
+            {
+                std::lock_guard lock(m_mutex);
+                m_cache.Add(std::move(scope), std::wstring(typedValue), std::vector<std::wstring>(values.begin(), values.end()));
+            }
+            if (!IsCurrentGeneration(generation))
+            {
+                co_return CreateSupersededResult(generation);
+            }
+
+            co_return make<SearchFieldSuggestionsResult>(generation, winrt::single_threaded_vector<hstring>(std::move(values)).GetView(), false);
+        }
+        catch (hresult_canceled const&)
+        {
+            ClearPendingOperation(operation);
+            co_return CreateSupersededResult(generation);
+        }
+        catch (hresult_error const& error)
+        {
+            ClearPendingOperation(operation);
+            co_return make<SearchFieldSuggestionsResult>(generation, error.code(), error.message());
+        }
+    }
+
+    void RepositorySearchSuggestionSession::CancelPendingRequest()
+    {
+        IAsyncInfo pendingOperation{ nullptr };
+        {
+            std::lock_guard lock(m_mutex);
+            ++m_generation;
+            pendingOperation = std::exchange(m_pendingOperation, nullptr);
+        }
+
+        if (pendingOperation)
+        {
+            pendingOperation.Cancel();
+        }
+    }
+
+    void RepositorySearchSuggestionSession::ClearCache()
+    {
+        std::lock_guard lock(m_mutex);
+        m_cache.Clear();
+    }
+
+    bool RepositorySearchSuggestionSession::IsCurrentGeneration(uint64_t generation)
+    {
+        std::lock_guard lock(m_mutex);
+        return m_generation == generation;
+    }
+
+    void RepositorySearchSuggestionSession::ClearPendingOperation(IAsyncInfo const& operation)
+    {
+        std::lock_guard lock(m_mutex);
+        if (operation && m_pendingOperation == operation)
+        {
+            m_pendingOperation = nullptr;
+        }
+    }
+}
@@ -0,0 +1,46 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include "RepositorySearchSuggestionSession.g.h"
+#include "SearchSuggestionCache.h"
+
+using namespace winrt::Windows::Foundation;
+using namespace winrt::Windows::Foundation::Collections;
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    struct RepositorySearchSuggestionSession : RepositorySearchSuggestionSessionT<RepositorySearchSuggestionSession>
+    {
+        RepositorySearchSuggestionSession(IRepositoryProvider2 const& provider, IDeveloperId const& developerId);
+
+        TimeSpan DebounceInterval();
+        void DebounceInterval(TimeSpan const& value);
+        bool IsPrefixFilteringEnabled();
+        void IsPrefixFilteringEnabled(bool value);
+        uint64_t CurrentGeneration();
+
+        IAsyncOperation<winrt::Microsoft::Windows::DevHome::SDK::SearchFieldSuggestionsResult> GetValuesForSearchFieldAsync(IMapView<hstring, hstring> fieldValues, hstring requestedSearchField);
+        void CancelPendingRequest();
+        void ClearCache();
+
+    private:
+        bool IsCurrentGeneration(uint64_t generation);
+        void ClearPendingOperation(IAsyncInfo const& operation);
+
+        IRepositoryProvider2 m_provider;
+        IDeveloperId m_developerId;
+        std::mutex m_mutex;
+        TimeSpan m_debounceInterval;
+        bool m_isPrefixFilteringEnabled;
+        uint64_t m_generation;
+        IAsyncInfo m_pendingOperation;
+        SearchSuggestionCache m_cache;
+    };
+}
+namespace winrt::Microsoft::Windows::DevHome::SDK::factory_implementation
+{
+    struct RepositorySearchSuggestionSession : RepositorySearchSuggestionSessionT<RepositorySearchSuggestionSession, implementation::RepositorySearchSuggestionSession>
+    {
+    };
+}
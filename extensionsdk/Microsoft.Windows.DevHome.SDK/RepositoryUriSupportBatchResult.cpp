@@ -0,0 +1,65 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "RepositoryUriSupportBatchResult.h"
+#include "RepositoryUriSupportBatchResult.g.cpp"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    RepositoryUriSupportBatchResult::RepositoryUriSupportBatchResult(array_view<RepositoryUriSupportEntry const> results) :
+        m_results(results.begin(), results.end()),
+        m_result(ProviderOperationStatus::Success, S_OK, hstring(), hstring())
+    {
+    }
+
+    RepositoryUriSupportBatchResult::RepositoryUriSupportBatchResult(std::vector<RepositoryUriSupportEntry>&& results) :
+        m_results(std::move(results)),
+        m_result(ProviderOperationStatus::Success, S_OK, hstring(), hstring())
+    {
+    }
+
+    RepositoryUriSupportBatchResult::RepositoryUriSupportBatchResult(winrt::hresult const& e, hstring const& diagnosticText) :
+        m_results(),
+        m_result(ProviderOperationStatus::Failure, e, diagnosticText, diagnosticText)
+    {
+    }
+
+    winrt::Microsoft::Windows::DevHome::SDK::RepositoryUriSupportBatchResult RepositoryUriSupportBatchResult::CreateFromResults(
+        array_view<winrt::Microsoft::Windows::DevHome::SDK::RepositoryUriSupportResult const> results)
+    {
+        std::vector<RepositoryUriSupportEntry> entries;
+        entries.reserve(results.size());
+        for (auto const& result : results)
+        {
+            if (!result)
+            {
+                throw hresult_invalid_argument(L"results parameter should not contain null results.");
+            }
+
+            auto operationResult = result.Result();
+            if (operationResult.Status() == ProviderOperationStatus::Success)
+            {
+                entries.push_back(RepositoryUriSupportEntry{ result.IsSupported(), S_OK, hstring() });
+            }
+            else
+            {
+                // Failed results are reported with a failure code, even when the extension didn't set one.
+                winrt::hresult error = operationResult.ExtendedError();
+                entries.push_back(RepositoryUriSupportEntry{ false, (error < 0) ? error : winrt::hresult{ E_FAIL }, operationResult.DiagnosticText() });
+            }
+        }
+
+        return make<RepositoryUriSupportBatchResult>(std::move(entries));
+    }
+
+    com_array<RepositoryUriSupportEntry> RepositoryUriSupportBatchResult::Results()
+    {
+        return com_array<RepositoryUriSupportEntry>(m_results.begin(), m_results.end());
+    }
+
+    ProviderOperationResult RepositoryUriSupportBatchResult::Result()
+    {
+        return m_result;
+    }
+}
@@ -0,0 +1,31 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include "RepositoryUriSupportBatchResult.g.h"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    struct RepositoryUriSupportBatchResult : RepositoryUriSupportBatchResultT<RepositoryUriSupportBatchResult>
+    {
+        RepositoryUriSupportBatchResult(array_view<RepositoryUriSupportEntry const> results);
+        RepositoryUriSupportBatchResult(std::vector<RepositoryUriSupportEntry>&& results);
+        RepositoryUriSupportBatchResult(winrt::hresult const& e, hstring const& diagnosticText);
+
+        static winrt::Microsoft::Windows::DevHome::SDK::RepositoryUriSupportBatchResult CreateFromResults(
+            array_view<winrt::Microsoft::Windows::DevHome::SDK::RepositoryUriSupportResult const> results);
+
+        com_array<RepositoryUriSupportEntry> Results();
+        ProviderOperationResult Result();
+
+    private:
+        std::vector<RepositoryUriSupportEntry> m_results;
+        ProviderOperationResult m_result;
+    };
+}
+namespace winrt::Microsoft::Windows::DevHome::SDK::factory_implementation
+{
+    struct RepositoryUriSupportBatchResult : RepositoryUriSupportBatchResultT<RepositoryUriSupportBatchResult, implementation::RepositoryUriSupportBatchResult>
+    {
+    };
+}
@@ -0,0 +1,50 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "SearchFieldSuggestionsResult.h"
+#include "SearchFieldSuggestionsResult.g.cpp"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    SearchFieldSuggestionsResult::SearchFieldSuggestionsResult(uint64_t generation, IVectorView<hstring> const& values, bool isFromCache) :
+        m_generation(generation),
+        m_values(values),
+        m_isFromCache(isFromCache),
+        m_result(ProviderOperationStatus::Success, S_OK, hstring(), hstring())
+    {
+    }
+
+    SearchFieldSuggestionsResult::SearchFieldSuggestionsResult(uint64_t generation, winrt::hresult const& e, hstring const& diagnosticText) :
+        m_generation(generation),
+        m_values(winrt::single_threaded_vector<hstring>().GetView()),
+        m_isFromCache(false),
+        m_result(ProviderOperationStatus::Failure, e, diagnosticText, diagnosticText)
+    {
+    }
+
+    uint64_t SearchFieldSuggestionsResult::Generation()
+    {
+        return m_generation;
+    }
+
+    IVectorView<hstring> SearchFieldSuggestionsResult::Values()
+    {
+        return m_values;
+    }
+
+    bool SearchFieldSuggestionsResult::IsFromCache()
+    {
+        return m_isFromCache;
+    }
+
+    bool SearchFieldSuggestionsResult::IsSuperseded()
+    {
+        return m_result.ExtendedError() == HRESULT_FROM_WIN32(ERROR_CANCELLED);
+    }
+
+    ProviderOperationResult SearchFieldSuggestionsResult::Result()
+    {
+        return m_result;
+    }
+}
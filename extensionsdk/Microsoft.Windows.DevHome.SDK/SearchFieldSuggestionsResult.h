@@ -0,0 +1,34 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include "SearchFieldSuggestionsResult.g.h"
+
+using namespace winrt::Windows::Foundation::Collections;
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    struct SearchFieldSuggestionsResult : SearchFieldSuggestionsResultT<SearchFieldSuggestionsResult>
+    {
+        SearchFieldSuggestionsResult(uint64_t generation, IVectorView<hstring> const& values, bool isFromCache);
+        SearchFieldSuggestionsResult(uint64_t generation, winrt::hresult const& e, hstring const& diagnosticText);
+
+        uint64_t Generation();
+        IVectorView<hstring> Values();
+        bool IsFromCache();
+        bool IsSuperseded();
+        ProviderOperationResult Result();
+
+    private:
+        uint64_t m_generation;
+        IVectorView<hstring> m_values;
+        bool m_isFromCache;
+        ProviderOperationResult m_result;
+    };
+}
+namespace winrt::Microsoft::Windows::DevHome::SDK::factory_implementation
+{
+    struct SearchFieldSuggestionsResult : SearchFieldSuggestionsResultT<SearchFieldSuggestionsResult, implementation::SearchFieldSuggestionsResult>
+    {
+    };
+}
@@ -0,0 +1,127 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "SearchSuggestionCache.h"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    namespace
+    {
+        // Case is ignored with the ordinal rules of Windows. Other platforms only build the class for tests, and
+        // compare with towupper of the C locale.
+#ifndef _WIN32
+        bool EqualsIgnoreCase(wchar_t left, wchar_t right)
+        {
+            return std::towupper(left) == std::towupper(right);
+        }
+#endif
+
+        bool StartsWithIgnoreCase(std::wstring_view value, std::wstring_view prefix)
+        {
+            if (prefix.size() > value.size())
+            {
+                return false;
+            }
+
+#ifdef _WIN32
+            return CompareStringOrdinal(value.data(), static_cast<int>(prefix.size()), prefix.data(), static_cast<int>(prefix.size()), TRUE) == CSTR_EQUAL;
+#else
+            return std::equal(prefix.begin(), prefix.end(), value.begin(), EqualsIgnoreCase);
+#endif
+        }
+
+        bool ContainsIgnoreCase(std::wstring_view value, std::wstring_view searchText)
+        {
+            if (searchText.empty())
+            {
+                return true;
+            }
+
+#ifdef _WIN32
+            return FindStringOrdinal(FIND_FROMSTART, value.data(), static_cast<int>(value.size()), searchText.data(), static_cast<int>(searchText.size()), TRUE) != -1;
+#else
+            return std::search(value.begin(), value.end(), searchText.begin(), searchText.end(), EqualsIgnoreCase) != value.end();
+#endif
+        }
+    }
+
+    // The fields are sorted so the scope doesn't depend on the order the map enumerates them in. A null
+    // character can't be part of a field name or value, so it separates them.
+    std::wstring SearchSuggestionCache::GetScope(std::wstring_view requestedField, std::vector<std::pair<std::wstring, std::wstring>> otherFields)
+    {
+        std::sort(otherFields.begin(), otherFields.end());
+
+        std::wstring scope{ requestedField };
+        for (auto const& [name, value] : otherFields)
+        {
+            scope.push_back(L'\0');
+            scope.append(name);
+            scope.push_back(L'\0');
+            scope.append(value);
+        }
+
+        return scope;
+    }
+
+    std::optional<std::vector<std::wstring>> SearchSuggestionCache::TryGet(std::wstring_view scope, std::wstring_view typedValue, bool isPrefixFilteringEnabled) const
+    {
+        Entry const* bestMatch = nullptr;
+        for (auto const& entry : m_entries)
+        {
+            if (entry.scope != scope)
+            {
+                continue;
+            }
+
+            auto isPrefixMatch = isPrefixFilteringEnabled && entry.typedValue.size() >= MinPrefixFilteringLength && StartsWithIgnoreCase(typedValue, entry.typedValue);
+            auto isMatch = isPrefixMatch || entry.typedValue == typedValue;
+            if (isMatch && (!bestMatch || entry.typedValue.size() > bestMatch->typedValue.size()))
+            {
+                bestMatch = &entry;
+            }
+        }
+
+        if (!bestMatch)
+        {
+            return std::nullopt;
+        }
+
+        if (bestMatch->typedValue.size() == typedValue.size())
+        {
+            return bestMatch->values;
+        }
+
+        std::vector<std::wstring> values;
+        std::copy_if(bestMatch->values.begin(), bestMatch->values.end(), std::back_inserter(values), [typedValue](std::wstring const& value) {
+            return ContainsIgnoreCase(value, typedValue);
+        });
+
+        return values;
+    }
+
+    void SearchSuggestionCache::Add(std::wstring scope, std::wstring typedValue, std::vector<std::wstring> values)
+    {
+        m_entries.erase(
+            std::remove_if(m_entries.begin(), m_entries.end(), [&](Entry const& entry) {
+                return entry.scope == scope && entry.typedValue == typedValue;
+            }),
+            m_entries.end());
+
+        m_entries.push_back(Entry{ std::move(scope), std::move(typedValue), std::move(values) });
+        if (m_entries.size() > MaxEntries)
+        {
+            m_entries.pop_front();
+        }
+    }
+
+    void SearchSuggestionCache::Clear()
+    {
+        m_entries.clear();
+    }
+
+    size_t SearchSuggestionCache::Count() const
+    {
+        return m_entries.size();
+    }
+}
@@ -0,0 +1,46 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    // The suggestions RepositorySearchSuggestionSession received from the provider, so they can be reused for the
+    // same request or filtered for a longer typed value. The scope identifies the requested field and the values
+    // of every other field at the time of the request; answers are never reused across scopes. Only the most
+    // recent MaxEntries answers are kept. This code only depends on the C++ standard library, so it can be tested
+    // and benchmarked on any platform. The class is not thread safe.
+    class SearchSuggestionCache
+    {
+    public:
+        static constexpr size_t MaxEntries = 32;
+
+        // Providers usually truncate the suggestions for empty and very short values, so their answers are only
+        // reused for the same value, never filtered for longer ones.
+        static constexpr size_t MinPrefixFilteringLength = 2;
+
+        // Builds the scope of a request from the requested field and the name and value of every other field.
+        static std::wstring GetScope(std::wstring_view requestedField, std::vector<std::pair<std::wstring, std::wstring>> otherFields);
+
+        // Returns the suggestions for typedValue if they were requested before. When isPrefixFilteringEnabled is
+        // set, the answer for the longest previously requested prefix of typedValue is filtered instead, keeping
+        // the values that contain typedValue. Prefixes and values are compared ignoring case.
+        std::optional<std::vector<std::wstring>> TryGet(std::wstring_view scope, std::wstring_view typedValue, bool isPrefixFilteringEnabled) const;
+
+        // Replaces any answer for the same scope and typed value, and drops the oldest answer past MaxEntries.
+        void Add(std::wstring scope, std::wstring typedValue, std::vector<std::wstring> values);
+
+        void Clear();
+        size_t Count() const;
+
+    private:
+        struct Entry
+        {
+            std::wstring scope;
+            std::wstring typedValue;
+            std::vector<std::wstring> values;
+        };
+
+        std::deque<Entry> m_entries;
+    };
+}
@@ -0,0 +1,426 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "TrigramIndex.h"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    namespace
+    {
+        // Text is padded at the start so that short queries still produce trigrams and prefixes share them.
+        constexpr wchar_t TrigramPadding = L'\x1';
+
+        // Released terms are only removed from the postings once there are this many of them.
+        constexpr size_t MinReleasedTermsToCompact = 1024;
+
+        // A single substitution, insertion or deletion changes at most three trigrams of the query. Swapping two
+        // adjacent characters changes four unless they are at the end, but allowing four missing trigrams would
+        // make a query like "repo-4242" match every "repo-" entry, and read all of them.
+        constexpr size_t MaxMissingTrigrams = 3;
+
+        // Scratch space is kept for at most this many concurrent searches, the rest is freed when they finish.
+        constexpr size_t MaxPooledScratch = 4;
+    }
+
+    uint32_t TrigramIndex::Add(std::wstring_view name, std::wstring_view owner, std::vector<std::wstring_view> const& topics)
+    {
+        uint32_t entry;
+        if (!m_freeEntries.empty())
+        {
+            entry = m_freeEntries.back();
+            m_freeEntries.pop_back();
+        }
+        else
+        {
+            entry = static_cast<uint32_t>(m_entries.size());
+            m_entries.emplace_back();
+        }
+
+        m_entries[entry].isInUse = true;
+        AddTerm(entry, Field::Name, name);
+        AddTerm(entry, Field::Owner, owner);
+        for (auto const& topic : topics)
+        {
+            AddTerm(entry, Field::Topics, topic);
+        }
+
+        m_entries[entry].terms.shrink_to_fit();
+        m_entries[entry].termPositions.shrink_to_fit();
+        ++m_count;
+        return entry;
+    }
+
+    void TrigramIndex::Remove(uint32_t entry)
+    {
+        if (entry >= m_entries.size() || !m_entries[entry].isInUse)
+        {
+            return;
+        }
+
+        auto& removedEntry = m_entries[entry];
+        for (size_t i = 0; i < removedEntry.terms.size(); i++)
+        {
+            auto term = removedEntry.terms[i];
+            RemoveTermEntry(term, removedEntry.termPositions[i]);
+            if (m_terms[term].entries.empty())
+            {
+                ReleaseTerm(term);
+            }
+        }
+
+        removedEntry.terms.clear();
+        removedEntry.termPositions.clear();
+        removedEntry.isInUse = false;
+        m_freeEntries.push_back(entry);
+        --m_count;
+    }
+
+    void TrigramIndex::Clear()
+    {
+        m_terms.clear();
+        m_freeTerms.clear();
+        m_releasedTerms.clear();
+        m_termLookup.clear();
+        m_postings.clear();
+        m_entries.clear();
+        m_freeEntries.clear();
+        m_count = 0;
+
+        std::lock_guard lock(m_scratchMutex);
+        m_scratch.clear();
+    }
+
+    size_t TrigramIndex::Count() const
+    {
+        return m_count;
+    }
+
+    std::vector<TrigramIndex::Match> TrigramIndex::Search(std::wstring_view query, uint32_t fields, size_t maxResults) const
+    {
+        // An entry scores as well as its best matching term.
+        auto scratch = AcquireScratch();
+        auto& entryScores = scratch.entryScores;
+        entryScores.Reset(m_entries.size());
+        for (auto const& [term, score] : ScoreTerms(query, fields, scratch.termHits))
+        {
+            auto weightedScore = score * GetFieldWeight(m_terms[term].field);
+            for (auto entry : m_terms[term].entries)
+            {
+                if (entryScores.values[entry] == 0)
+                {
+                    entryScores.setIndexes.push_back(entry);
+                }
+
+                entryScores.values[entry] = std::max(entryScores.values[entry], weightedScore);
+            }
+        }
+
+        std::vector<Match> matches;
+        matches.reserve(entryScores.setIndexes.size());
+        for (auto entry : entryScores.setIndexes)
+        {
+            matches.push_back(Match{ entry, entryScores.values[entry] });
+        }
+
+        auto resultCount = std::min(maxResults, matches.size());
+        std::partial_sort(matches.begin(), matches.begin() + resultCount, matches.end(), [](Match const& left, Match const& right) {
+            return left.score != right.score ? left.score > right.score : left.entry < right.entry;
+        });
+
+        matches.resize(resultCount);
+        ReleaseScratch(std::move(scratch));
+        return matches;
+    }
+
+    std::vector<std::wstring> TrigramIndex::Suggest(Field field, std::wstring_view query, size_t maxResults) const
+    {
+        std::vector<std::pair<uint32_t, double>> termScores;
+        if (query.empty())
+        {
+            for (uint32_t term = 0; term < m_terms.size(); term++)
+            {
+                if (m_terms[term].field == field && !m_terms[term].entries.empty())
+                {
+                    termScores.emplace_back(term, static_cast<double>(m_terms[term].entries.size()));
+                }
+            }
+        }
+        else
+        {
+            auto scratch = AcquireScratch();
+            termScores = ScoreTerms(query, field, scratch.termHits);
+            ReleaseScratch(std::move(scratch));
+        }
+
+        auto resultCount = std::min(maxResults, termScores.size());
+        std::partial_sort(termScores.begin(), termScores.begin() + resultCount, termScores.end(), [this](auto const& left, auto const& right) {
+            return left.second != right.second ? left.second > right.second : m_terms[left.first].text < m_terms[right.first].text;
+        });
+
+        std::vector<std::wstring> values;
+        values.reserve(resultCount);
+        for (size_t i = 0; i < resultCount; i++)
+        {
+            values.push_back(m_terms[termScores[i].first].text);
+        }
+
+        return values;
+    }
+
+    // Uppercases the text with the invariant locale, the rules CompareStringOrdinal and FindStringOrdinal use when
+    // they ignore case, so the index behaves the same whatever the locale of the process is. Other platforms only
+    // build the class for tests, and use towupper of the C locale.
+    std::wstring TrigramIndex::Fold(std::wstring_view text)
+    {
+        std::wstring foldedText(text);
+        if (foldedText.empty())
+        {
+            return foldedText;
+        }
+
+#ifdef _WIN32
+        LCMapStringEx(LOCALE_NAME_INVARIANT, LCMAP_UPPERCASE, text.data(), static_cast<int>(text.size()), foldedText.data(), static_cast<int>(foldedText.size()), nullptr, nullptr, 0);
+#else
+        std::transform(foldedText.begin(), foldedText.end(), foldedText.begin(), [](wchar_t c) { return static_cast<wchar_t>(std::towupper(c)); });
+#endif
+
+        return foldedText;
+    }
+
+    // Returns the distinct trigrams of the padded text, sorted. Each trigram packs three UTF-16 code units.
+    std::vector<uint64_t> TrigramIndex::GetTrigrams(std::wstring_view foldedText)
+    {
+        std::wstring paddedText(2, TrigramPadding);
+        paddedText.append(foldedText);
+
+        std::vector<uint64_t> trigrams;
+        trigrams.reserve(foldedText.size());
+        for (size_t i = 0; i + 2 < paddedText.size(); i++)
+        {
+            trigrams.push_back(
+                (static_cast<uint64_t>(static_cast<uint16_t>(paddedText[i])) << 32) |
+                (static_cast<uint64_t>(static_cast<uint16_t>(paddedText[i + 1])) << 16) |
+                static_cast<uint64_t>(static_cast<uint16_t>(paddedText[i + 2])));
+        }
+
+        std::sort(trigrams.begin(), trigrams.end());
+        trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+        return trigrams;
+    }
+
+    std::wstring TrigramIndex::GetTermKey(uint32_t field, std::wstring_view foldedText)
+    {
+        std::wstring key(1, static_cast<wchar_t>(field));
+        key.append(foldedText);
+        return key;
+    }
+
+    double TrigramIndex::GetFieldWeight(uint32_t field)
+    {
+        switch (field)
+        {
+        case Field::Name:
+            return 1.0;
+        case Field::Owner:
+            return 0.75;
+        default:
+            return 0.5;
+        }
+    }
+
+    void TrigramIndex::AddTerm(uint32_t entry, uint32_t field, std::wstring_view text)
+    {
+        if (text.empty())
+        {
+            return;
+        }
+
+        auto foldedText = Fold(text);
+        auto key = GetTermKey(field, foldedText);
+        uint32_t term;
+        if (auto it = m_termLookup.find(key); it != m_termLookup.end())
+        {
+            term = it->second;
+        }
+        else
+        {
+            if (!m_freeTerms.empty())
+            {
+                term = m_freeTerms.back();
+                m_freeTerms.pop_back();
+            }
+            else
+            {
+                term = static_cast<uint32_t>(m_terms.size());
+                m_terms.emplace_back();
+            }
+
+            auto trigrams = GetTrigrams(foldedText);
+            for (auto trigram : trigrams)
+            {
+                m_postings[trigram].push_back(term);
+            }
+
+            m_terms[term] = Term{ std::wstring(text), std::move(foldedText), field, static_cast<uint32_t>(trigrams.size()), {} };
+            m_termLookup.emplace(std::move(key), term);
+        }
+
+        // The same topic can be listed twice for an entry.
+        auto& addedEntry = m_entries[entry];
+        if (std::find(addedEntry.terms.begin(), addedEntry.terms.end(), term) == addedEntry.terms.end())
+        {
+            addedEntry.terms.push_back(term);
+            addedEntry.termPositions.push_back(static_cast<uint32_t>(m_terms[term].entries.size()));
+            m_terms[term].entries.push_back(entry);
+        }
+    }
+
+    // Removes the entry at position from the entries of the term by moving the last entry into its place, and
+    // updates the position the moved entry keeps for the term.
+    void TrigramIndex::RemoveTermEntry(uint32_t term, uint32_t position)
+    {
+        auto& termEntries = m_terms[term].entries;
+        auto movedEntry = termEntries.back();
+        termEntries[position] = movedEntry;
+        termEntries.pop_back();
+        if (position == termEntries.size())
+        {
+            return;
+        }
+
+        auto& entry = m_entries[movedEntry];
+        auto it = std::find(entry.terms.begin(), entry.terms.end(), term);
+        entry.termPositions[it - entry.terms.begin()] = position;
+    }
+
+    // A released term keeps its id, and a field of 0 so that searches skip it, until the postings are compacted.
+    void TrigramIndex::ReleaseTerm(uint32_t term)
+    {
+        auto& releasedTerm = m_terms[term];
+        m_termLookup.erase(GetTermKey(releasedTerm.field, releasedTerm.foldedText));
+        releasedTerm = Term{};
+        m_releasedTerms.push_back(term);
+
+        auto liveTermCount = m_terms.size() - m_freeTerms.size() - m_releasedTerms.size();
+        if (m_releasedTerms.size() >= MinReleasedTermsToCompact && m_releasedTerms.size() >= liveTermCount / 4)
+        {
+            CompactPostings();
+        }
+    }
+
+    void TrigramIndex::CompactPostings()
+    {
+        for (auto it = m_postings.begin(); it != m_postings.end();)
+        {
+            auto& terms = it->second;
+            terms.erase(std::remove_if(terms.begin(), terms.end(), [this](uint32_t term) { return m_terms[term].field == 0; }), terms.end());
+            if (terms.empty())
+            {
+                it = m_postings.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        m_freeTerms.insert(m_freeTerms.end(), m_releasedTerms.begin(), m_releasedTerms.end());
+        m_releasedTerms.clear();
+    }
+
+    // Scores every term of the requested fields that shares at least half of the query's trigrams and misses at
+    // most the trigrams of a single edit. The score is the Jaccard similarity of the trigram
+    // sets, with a bonus when the term starts with or contains the query.
+    std::vector<std::pair<uint32_t, double>> TrigramIndex::ScoreTerms(std::wstring_view query, uint32_t fields, SparseAccumulator<uint32_t>& hits) const
+    {
+        std::vector<std::pair<uint32_t, double>> termScores;
+        auto foldedQuery = Fold(query);
+        if (foldedQuery.empty())
+        {
+            return termScores;
+        }
+
+        auto queryTrigrams = GetTrigrams(foldedQuery);
+        std::vector<std::vector<uint32_t> const*> postings;
+        for (auto trigram : queryTrigrams)
+        {
+            if (auto it = m_postings.find(trigram); it != m_postings.end())
+            {
+                postings.push_back(&it->second);
+            }
+        }
+
+        // A term that is missing from the rarest (trigram count - required hits + 1) postings can't reach the
+        // required hits. Only those postings add candidates, the common ones just count hits of existing
+        // candidates, which keeps queries sharing a prefix with most of the index cheap.
+        std::sort(postings.begin(), postings.end(), [](auto left, auto right) { return left->size() < right->size(); });
+        auto requiredHits = std::max((queryTrigrams.size() + 1) / 2, queryTrigrams.size() - std::min(queryTrigrams.size(), MaxMissingTrigrams));
+        auto candidatePostingsCount = queryTrigrams.size() - requiredHits + 1;
+
+        hits.Reset(m_terms.size());
+        for (size_t i = 0; i < postings.size(); i++)
+        {
+            auto addsCandidates = i < candidatePostingsCount;
+            for (auto term : *postings[i])
+            {
+                if (hits.values[term] != 0)
+                {
+                    ++hits.values[term];
+                }
+                else if (addsCandidates && (m_terms[term].field & fields) != 0)
+                {
+                    hits.values[term] = 1;
+                    hits.setIndexes.push_back(term);
+                }
+            }
+        }
+
+        for (auto term : hits.setIndexes)
+        {
+            if (hits.values[term] < requiredHits)
+            {
+                continue;
+            }
+
+            auto const& scoredTerm = m_terms[term];
+            auto score = static_cast<double>(hits.values[term]) / static_cast<double>(queryTrigrams.size() + scoredTerm.trigramCount - hits.values[term]);
+            auto position = scoredTerm.foldedText.find(foldedQuery);
+            if (position == 0)
+            {
+                score += 1.0;
+            }
+            else if (position != std::wstring::npos)
+            {
+                score += 0.5;
+            }
+
+            termScores.emplace_back(term, score);
+        }
+
+        return termScores;
+    }
+    // Scratch space is sized for the index, so a search only allocates when no earlier search left scratch space
+    // behind or the index grew.
+    TrigramIndex::SearchScratch TrigramIndex::AcquireScratch() const
+    {
+        std::lock_guard lock(m_scratchMutex);
+        if (m_scratch.empty())
+        {
+            return SearchScratch{};
+        }
+
+        auto scratch = std::move(m_scratch.back());
+        m_scratch.pop_back();
+        return scratch;
+    }
+
+    void TrigramIndex::ReleaseScratch(SearchScratch&& scratch) const
+    {
+        std::lock_guard lock(m_scratchMutex);
+        if (m_scratch.size() < MaxPooledScratch)
+        {
+            m_scratch.push_back(std::move(scratch));
+        }
+    }
+}
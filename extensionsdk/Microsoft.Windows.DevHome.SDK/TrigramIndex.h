@@ -0,0 +1,114 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    // Fuzzy text index behind RepositorySearchIndex. Every distinct (field, text) pair is stored once as a term
+    // with its own trigram postings, and entries only reference terms. Owners and topics shared by many entries
+    // therefore cost a single set of postings. Removed entries are recycled through a free list. Terms that are no
+    // longer referenced stay in the postings, where they are skipped, until enough of them accumulate to compact
+    // the postings in one pass; removing from postings shared by most terms one by one would be quadratic.
+    // Search and Suggest can run concurrently with each other, every other method needs exclusive access.
+    class TrigramIndex
+    {
+    public:
+        // Matches the values of RepositorySearchFields.
+        enum Field : uint32_t
+        {
+            Name = 0x1,
+            Owner = 0x2,
+            Topics = 0x4,
+        };
+
+        struct Match
+        {
+            uint32_t entry;
+            double score;
+        };
+
+        uint32_t Add(std::wstring_view name, std::wstring_view owner, std::vector<std::wstring_view> const& topics);
+        void Remove(uint32_t entry);
+        void Clear();
+        size_t Count() const;
+
+        std::vector<Match> Search(std::wstring_view query, uint32_t fields, size_t maxResults) const;
+        std::vector<std::wstring> Suggest(Field field, std::wstring_view query, size_t maxResults) const;
+
+    private:
+        struct Term
+        {
+            std::wstring text;
+            std::wstring foldedText;
+            uint32_t field;
+            uint32_t trigramCount;
+            std::vector<uint32_t> entries;
+        };
+
+        struct Entry
+        {
+            std::vector<uint32_t> terms;
+
+            // termPositions[i] is the position of the entry in the entries of terms[i], so that removing the entry
+            // doesn't search the entries of terms shared by many entries.
+            std::vector<uint32_t> termPositions;
+            bool isInUse;
+        };
+
+        // A value per term or entry with the indexes of the values that were set. Resetting only clears the
+        // values the previous search set, instead of allocating and clearing a value for every term or entry.
+        template <typename T>
+        struct SparseAccumulator
+        {
+            std::vector<T> values;
+            std::vector<uint32_t> setIndexes;
+
+            void Reset(size_t size)
+            {
+                for (auto index : setIndexes)
+                {
+                    values[index] = T{};
+                }
+
+                setIndexes.clear();
+                if (values.size() < size)
+                {
+                    values.resize(size);
+                }
+            }
+        };
+
+        struct SearchScratch
+        {
+            SparseAccumulator<uint32_t> termHits;
+            SparseAccumulator<double> entryScores;
+        };
+
+        static std::wstring Fold(std::wstring_view text);
+        static std::vector<uint64_t> GetTrigrams(std::wstring_view foldedText);
+        static std::wstring GetTermKey(uint32_t field, std::wstring_view foldedText);
+        static double GetFieldWeight(uint32_t field);
+
+        void AddTerm(uint32_t entry, uint32_t field, std::wstring_view text);
+        void RemoveTermEntry(uint32_t term, uint32_t position);
+        void ReleaseTerm(uint32_t term);
+        void CompactPostings();
+        std::vector<std::pair<uint32_t, double>> ScoreTerms(std::wstring_view query, uint32_t fields, SparseAccumulator<uint32_t>& hits) const;
+        SearchScratch AcquireScratch() const;
+        void ReleaseScratch(SearchScratch&& scratch) const;
+
+        std::vector<Term> m_terms;
+        std::vector<uint32_t> m_freeTerms;
+        std::vector<uint32_t> m_releasedTerms;
+        std::unordered_map<std::wstring, uint32_t> m_termLookup;
+        std::unordered_map<uint64_t, std::vector<uint32_t>> m_postings;
+        std::vector<Entry> m_entries;
+        std::vector<uint32_t> m_freeEntries;
+        size_t m_count{ 0 };
+
+        // Scratch space of finished searches, reused by the next ones.
+        mutable std::mutex m_scratchMutex;
+        mutable std::vector<SearchScratch> m_scratch;
+    };
+}
@@ -0,0 +1,216 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "WarmStartCache.h"
+#include "WarmStartCache.g.cpp"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    namespace
+    {
+        // wchar_t and char16_t are both UTF-16 code units on Windows.
+        std::u16string_view ToView(hstring const& text)
+        {
+            return { reinterpret_cast<char16_t const*>(text.c_str()), text.size() };
+        }
+
+        hstring ToHString(std::u16string_view text)
+        {
+            return hstring(reinterpret_cast<wchar_t const*>(text.data()), static_cast<uint32_t>(text.size()));
+        }
+
+        Windows::Foundation::DateTime ToDateTime(int64_t ticks)
+        {
+            return Windows::Foundation::DateTime{ Windows::Foundation::TimeSpan{ ticks } };
+        }
+    }
+
+    WarmStartCache::WarmStartCache(hstring const& path) :
+        m_path(path)
+    {
+        OpenFile();
+    }
+
+    winrt::Microsoft::Windows::DevHome::SDK::WarmStartCache WarmStartCache::Load(hstring const& path)
+    {
+        return make<WarmStartCache>(path);
+    }
+
+    hstring WarmStartCache::Path()
+    {
+        return m_path;
+    }
+
+    com_array<ComputeSystemInfo> WarmStartCache::GetComputeSystems(hstring const& providerId, hstring const& developerId)
+    {
+        std::lock_guard lock(m_mutex);
+        auto it = m_computeSystems.find({ providerId, developerId });
+        if (it != m_computeSystems.end())
+        {
+            return com_array<ComputeSystemInfo>(it->second.begin(), it->second.end());
+        }
+
+        auto entry = m_reader ? m_reader->Find(WarmStartEntryKind::ComputeSystems, ToView(providerId), ToView(developerId)) : std::nullopt;
+        if (!entry)
+        {
+            return {};
+        }
+
+        com_array<ComputeSystemInfo> computeSystems(entry->itemCount);
+        for (uint32_t i = 0; i < entry->itemCount; i++)
+        {
+            auto computeSystem = m_reader->GetComputeSystem(*entry, i);
+            computeSystems[i] = ComputeSystemInfo{
+                ToHString(computeSystem.id),
+                ToHString(computeSystem.displayName),
+                ToHString(computeSystem.supplementalDisplayName),
+                static_cast<ComputeSystemState>(computeSystem.state),
+                static_cast<ComputeSystemOperations>(computeSystem.supportedOperations) };
+        }
+
+        return computeSystems;
+    }
+
+    com_array<RepositoryInfo> WarmStartCache::GetRepositories(hstring const& providerId, hstring const& developerId)
+    {
+        std::lock_guard lock(m_mutex);
+        auto it = m_repositories.find({ providerId, developerId });
+        if (it != m_repositories.end())
+        {
+            return com_array<RepositoryInfo>(it->second.begin(), it->second.end());
+        }
+
+        auto entry = m_reader ? m_reader->Find(WarmStartEntryKind::Repositories, ToView(providerId), ToView(developerId)) : std::nullopt;
+        if (!entry)
+        {
+            return {};
+        }
+
+        com_array<RepositoryInfo> repositories(entry->itemCount);
+        for (uint32_t i = 0; i < entry->itemCount; i++)
+        {
+            auto repository = m_reader->GetRepository(*entry, i);
+            repositories[i] = RepositoryInfo{
+                ToHString(repository.displayName),
+                ToHString(repository.owningAccountName),
+                repository.isPrivate,
+                ToDateTime(repository.lastUpdated),
+                ToHString(repository.repoUri) };
+        }
+
+        return repositories;
+    }
+
+    void WarmStartCache::SetComputeSystems(hstring const& providerId, hstring const& developerId, array_view<ComputeSystemInfo const> computeSystems)
+    {
+        std::lock_guard lock(m_mutex);
+        m_computeSystems.insert_or_assign({ providerId, developerId }, std::vector<ComputeSystemInfo>(computeSystems.begin(), computeSystems.end()));
+    }
+
+    void WarmStartCache::SetRepositories(hstring const& providerId, hstring const& developerId, array_view<RepositoryInfo const> repositories)
+    {
+        std::lock_guard lock(m_mutex);
+        m_repositories.insert_or_assign({ providerId, developerId }, std::vector<RepositoryInfo>(repositories.begin(), repositories.end()));
+    }
+
+    bool WarmStartCache::Save()
+    {
+        std::lock_guard lock(m_mutex);
+        WarmStartCacheWriter writer;
+        for (auto const& [key, computeSystems] : m_computeSystems)
+        {
+            std::vector<WarmStartComputeSystem> records;
+            records.reserve(computeSystems.size());
+            for (auto const& computeSystem : computeSystems)
+            {
+                records.push_back(WarmStartComputeSystem{
+                    ToView(computeSystem.Id),
+                    ToView(computeSystem.DisplayName),
+                    ToView(computeSystem.SupplementalDisplayName),
+                    static_cast<uint32_t>(computeSystem.State),
+                    static_cast<uint32_t>(computeSystem.SupportedOperations) });
+            }
+
+            writer.AddComputeSystems(ToView(key.first), ToView(key.second), records);
+        }
+
+        for (auto const& [key, repositories] : m_repositories)
+        {
+            std::vector<WarmStartRepository> records;
+            records.reserve(repositories.size());
+            for (auto const& repository : repositories)
+            {
+                records.push_back(WarmStartRepository{
+                    ToView(repository.DisplayName),
+                    ToView(repository.OwningAccountName),
+                    ToView(repository.RepoUri),
+                    repository.IsPrivate,
+                    repository.LastUpdated.time_since_epoch().count() });
+            }
+
+            writer.AddRepositories(ToView(key.first), ToView(key.second), records);
+        }
+
+        // Entries of the file that weren't replaced are copied from the mapped records.
+        if (m_reader)
+        {
+            for (size_t i = 0; i < m_reader->EntryCount(); i++)
+            {
+                auto entry = m_reader->GetEntry(i);
+                EntryKey key{ ToHString(entry.providerId), ToHString(entry.developerId) };
+                if (entry.kind == WarmStartEntryKind::ComputeSystems && !m_computeSystems.count(key))
+                {
+                    std::vector<WarmStartComputeSystem> records;
+                    records.reserve(entry.itemCount);
+                    for (uint32_t item = 0; item < entry.itemCount; item++)
+                    {
+                        records.push_back(m_reader->GetComputeSystem(entry, item));
+                    }
+
+                    writer.AddComputeSystems(entry.providerId, entry.developerId, records);
+                }
+                else if (entry.kind == WarmStartEntryKind::Repositories && !m_repositories.count(key))
+                {
+                    std::vector<WarmStartRepository> records;
+                    records.reserve(entry.itemCount);
+                    for (uint32_t item = 0; item < entry.itemCount; item++)
+                    {
+                        records.push_back(m_reader->GetRepository(entry, item));
+                    }
+
+                    writer.AddRepositories(entry.providerId, entry.developerId, records);
+                }
+            }
+        }
+
+        auto bytes = writer.Serialize();
+
+        // The file can't be replaced while it is mapped. The writer has copied its entries.
+        m_reader.reset();
+        m_file.Close();
+        auto succeeded = WriteWarmStartCacheFile(std::filesystem::path{ m_path.c_str() }, bytes);
+        OpenFile();
+
+        if (succeeded)
+        {
+            m_computeSystems.clear();
+            m_repositories.clear();
+        }
+
+        return succeeded;
+    }
+
+    void WarmStartCache::OpenFile()
+    {
+        // A missing, corrupt or incompatible file is treated as an empty cache.
+        if (!m_path.empty() && m_file.Open(std::filesystem::path{ m_path.c_str() }))
+        {
+            m_reader = WarmStartCacheReader::Open(m_file.Data(), m_file.Size());
+            if (!m_reader)
+            {
+                m_file.Close();
+            }
+        }
+    }
+}
@@ -0,0 +1,43 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include "WarmStartCache.g.h"
+#include "WarmStartCacheFile.h"
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    struct WarmStartCache : WarmStartCacheT<WarmStartCache>
+    {
+        WarmStartCache(hstring const& path);
+
+        static winrt::Microsoft::Windows::DevHome::SDK::WarmStartCache Load(hstring const& path);
+
+        hstring Path();
+        com_array<ComputeSystemInfo> GetComputeSystems(hstring const& providerId, hstring const& developerId);
+        com_array<RepositoryInfo> GetRepositories(hstring const& providerId, hstring const& developerId);
+        void SetComputeSystems(hstring const& providerId, hstring const& developerId, array_view<ComputeSystemInfo const> computeSystems);
+        void SetRepositories(hstring const& providerId, hstring const& developerId, array_view<RepositoryInfo const> repositories);
+        bool Save();
+
+    private:
+        using EntryKey = std::pair<hstring, hstring>;
+
+        void OpenFile();
+
+        std::mutex m_mutex;
+        hstring m_path;
+        WarmStartMappedFile m_file;
+        std::optional<WarmStartCacheReader> m_reader;
+
+        // Entries set since the file was last saved. They replace the entries of the file with the same key.
+        std::map<EntryKey, std::vector<ComputeSystemInfo>> m_computeSystems;
+        std::map<EntryKey, std::vector<RepositoryInfo>> m_repositories;
+    };
+}
+namespace winrt::Microsoft::Windows::DevHome::SDK::factory_implementation
+{
+    struct WarmStartCache : WarmStartCacheT<WarmStartCache, implementation::WarmStartCache>
+    {
+    };
+}
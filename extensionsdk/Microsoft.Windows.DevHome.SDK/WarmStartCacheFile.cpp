@@ -0,0 +1,474 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "Fnv1aHash.h"
+#include "WarmStartCacheFile.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    namespace
+    {
+        // "DHWC" in little endian. The version changes whenever the layout below changes.
+        constexpr uint32_t Magic = 0x43574844;
+        constexpr uint32_t Version = 1;
+
+        // Header: magic, version, file size, entry count, string table offset, reserved, then the 64-bit
+        // checksum of everything after the header.
+        constexpr size_t HeaderSize = 32;
+        constexpr size_t ChecksumOffset = 24;
+
+        // Entry: kind, provider ID, developer ID, item count, items offset.
+        constexpr size_t EntrySize = 20;
+
+        // Compute system: ID, display name, supplemental display name, state, supported operations.
+        constexpr size_t ComputeSystemFieldCount = 5;
+        constexpr size_t ComputeSystemRecordSize = ComputeSystemFieldCount * sizeof(uint32_t);
+
+        // Repository: display name, owning account name, Uri, is private, then the 64-bit last updated time.
+        constexpr size_t RepositoryFieldCount = 4;
+        constexpr size_t RepositoryRecordSize = RepositoryFieldCount * sizeof(uint32_t) + sizeof(int64_t);
+
+        // Strings are a 32-bit length in code units followed by the code units, padded to a multiple of four
+        // bytes so that every string is aligned.
+        constexpr size_t StringAlignment = 4;
+
+        size_t GetRecordSize(WarmStartEntryKind kind)
+        {
+            return (kind == WarmStartEntryKind::ComputeSystems) ? ComputeSystemRecordSize : RepositoryRecordSize;
+        }
+
+        size_t GetStringSize(size_t length)
+        {
+            auto size = sizeof(uint32_t) + length * sizeof(char16_t);
+            return (size + StringAlignment - 1) & ~(StringAlignment - 1);
+        }
+
+        // Strings are returned as views of the file, which is only possible when the file and the machine
+        // agree on the byte order.
+        bool IsLittleEndian()
+        {
+            uint16_t value = 1;
+            uint8_t firstByte;
+            std::memcpy(&firstByte, &value, sizeof(firstByte));
+            return firstByte == 1;
+        }
+
+        uint64_t GetChecksum(uint8_t const* data, size_t size)
+        {
+            Fnv1aHash hash;
+            hash.AddBytes(data, size);
+            return hash.Value();
+        }
+
+        void WriteUInt32(std::vector<uint8_t>& bytes, size_t offset, uint32_t value)
+        {
+            for (size_t i = 0; i < sizeof(value); i++)
+            {
+                bytes[offset + i] = static_cast<uint8_t>(value >> (i * 8));
+            }
+        }
+
+        void WriteUInt64(std::vector<uint8_t>& bytes, size_t offset, uint64_t value)
+        {
+            for (size_t i = 0; i < sizeof(value); i++)
+            {
+                bytes[offset + i] = static_cast<uint8_t>(value >> (i * 8));
+            }
+        }
+    }
+
+    void WarmStartCacheWriter::AddComputeSystems(std::u16string_view providerId, std::u16string_view developerId, std::vector<WarmStartComputeSystem> const& computeSystems)
+    {
+        Entry entry{ WarmStartEntryKind::ComputeSystems, Intern(providerId), Intern(developerId), static_cast<uint32_t>(computeSystems.size()), {}, {} };
+        entry.fields.reserve(computeSystems.size() * ComputeSystemFieldCount);
+        for (auto const& computeSystem : computeSystems)
+        {
+            entry.fields.push_back(Intern(computeSystem.id));
+            entry.fields.push_back(Intern(computeSystem.displayName));
+            entry.fields.push_back(Intern(computeSystem.supplementalDisplayName));
+            entry.fields.push_back(computeSystem.state);
+            entry.fields.push_back(computeSystem.supportedOperations);
+        }
+
+        m_entries.push_back(std::move(entry));
+    }
+
+    void WarmStartCacheWriter::AddRepositories(std::u16string_view providerId, std::u16string_view developerId, std::vector<WarmStartRepository> const& repositories)
+    {
+        Entry entry{ WarmStartEntryKind::Repositories, Intern(providerId), Intern(developerId), static_cast<uint32_t>(repositories.size()), {}, {} };
+        entry.fields.reserve(repositories.size() * RepositoryFieldCount);
+        entry.timestamps.reserve(repositories.size());
+        for (auto const& repository : repositories)
+        {
+            entry.fields.push_back(Intern(repository.displayName));
+            entry.fields.push_back(Intern(repository.owningAccountName));
+            entry.fields.push_back(Intern(repository.repoUri));
+            entry.fields.push_back(repository.isPrivate ? 1 : 0);
+            entry.timestamps.push_back(repository.lastUpdated);
+        }
+
+        m_entries.push_back(std::move(entry));
+    }
+
+    std::vector<uint8_t> WarmStartCacheWriter::Serialize() const
+    {
+        size_t size = HeaderSize + m_entries.size() * EntrySize;
+        std::vector<size_t> itemsOffsets;
+        itemsOffsets.reserve(m_entries.size());
+        for (auto const& entry : m_entries)
+        {
+            itemsOffsets.push_back(size);
+            size += entry.itemCount * GetRecordSize(entry.kind);
+        }
+
+        auto stringTableOffset = size;
+        std::vector<uint32_t> stringOffsets;
+        stringOffsets.reserve(m_strings.size());
+        for (auto const& text : m_strings)
+        {
+            stringOffsets.push_back(static_cast<uint32_t>(size));
+            size += GetStringSize(text.size());
+        }
+
+        if (size > UINT32_MAX)
+        {
+            throw std::length_error("The warm start cache is too large.");
+        }
+
+        std::vector<uint8_t> bytes(size);
+        WriteUInt32(bytes, 0, Magic);
+        WriteUInt32(bytes, 4, Version);
+        WriteUInt32(bytes, 8, static_cast<uint32_t>(size));
+        WriteUInt32(bytes, 12, static_cast<uint32_t>(m_entries.size()));
+        WriteUInt32(bytes, 16, static_cast<uint32_t>(stringTableOffset));
+
+        for (size_t i = 0; i < m_entries.size(); i++)
+        {
+            auto const& entry = m_entries[i];
+            auto offset = HeaderSize + i * EntrySize;
+            WriteUInt32(bytes, offset, static_cast<uint32_t>(entry.kind));
+            WriteUInt32(bytes, offset + 4, stringOffsets[entry.providerId]);
+            WriteUInt32(bytes, offset + 8, stringOffsets[entry.developerId]);
+            WriteUInt32(bytes, offset + 12, entry.itemCount);
+            WriteUInt32(bytes, offset + 16, static_cast<uint32_t>(itemsOffsets[i]));
+
+            auto fieldCount = (entry.kind == WarmStartEntryKind::ComputeSystems) ? ComputeSystemFieldCount : RepositoryFieldCount;
+            auto recordOffset = itemsOffsets[i];
+            for (uint32_t item = 0; item < entry.itemCount; item++)
+            {
+                auto fields = &entry.fields[item * fieldCount];
+                if (entry.kind == WarmStartEntryKind::ComputeSystems)
+                {
+                    WriteUInt32(bytes, recordOffset, stringOffsets[fields[0]]);
+                    WriteUInt32(bytes, recordOffset + 4, stringOffsets[fields[1]]);
+                    WriteUInt32(bytes, recordOffset + 8, stringOffsets[fields[2]]);
+                    WriteUInt32(bytes, recordOffset + 12, fields[3]);
+                    WriteUInt32(bytes, recordOffset + 16, fields[4]);
+                }
+                else
+                {
+                    WriteUInt32(bytes, recordOffset, stringOffsets[fields[0]]);
+                    WriteUInt32(bytes, recordOffset + 4, stringOffsets[fields[1]]);
+                    WriteUInt32(bytes, recordOffset + 8, stringOffsets[fields[2]]);
+                    WriteUInt32(bytes, recordOffset + 12, fields[3]);
+                    WriteUInt64(bytes, recordOffset + 16, static_cast<uint64_t>(entry.timestamps[item]));
+                }
+
+                recordOffset += GetRecordSize(entry.kind);
+            }
+        }
+
+        for (size_t i = 0; i < m_strings.size(); i++)
+        {
+            auto const& text = m_strings[i];
+            WriteUInt32(bytes, stringOffsets[i], static_cast<uint32_t>(text.size()));
+            auto offset = stringOffsets[i] + sizeof(uint32_t);
+            for (auto codeUnit : text)
+            {
+                bytes[offset++] = static_cast<uint8_t>(codeUnit);
+                bytes[offset++] = static_cast<uint8_t>(codeUnit >> 8);
+            }
+        }
+
+        WriteUInt64(bytes, ChecksumOffset, GetChecksum(bytes.data() + HeaderSize, size - HeaderSize));
+        return bytes;
+    }
+
+    uint32_t WarmStartCacheWriter::Intern(std::u16string_view text)
+    {
+        std::u16string key{ text };
+        auto it = m_stringLookup.find(key);
+        if (it != m_stringLookup.end())
+        {
+            return it->second;
+        }
+
+        auto index = static_cast<uint32_t>(m_strings.size());
+        m_strings.push_back(key);
+        m_stringLookup.emplace(std::move(key), index);
+        return index;
+    }
+
+    WarmStartCacheReader::WarmStartCacheReader(uint8_t const* data, size_t size) :
+        m_data(data), m_size(size)
+    {
+    }
+
+    std::optional<WarmStartCacheReader> WarmStartCacheReader::Open(uint8_t const* data, size_t size)
+    {
+        if (!IsLittleEndian() || (data == nullptr) || (size < HeaderSize) || (size > UINT32_MAX))
+        {
+            return std::nullopt;
+        }
+
+        WarmStartCacheReader reader{ data, size };
+        if ((reader.ReadUInt32(0) != Magic) || (reader.ReadUInt32(4) != Version) || (reader.ReadUInt32(8) != size))
+        {
+            return std::nullopt;
+        }
+
+        auto entryCount = reader.ReadUInt32(12);
+        size_t stringTableOffset = reader.ReadUInt32(16);
+        size_t entryTableEnd = HeaderSize + static_cast<size_t>(entryCount) * EntrySize;
+        if ((entryTableEnd > stringTableOffset) || (stringTableOffset > size))
+        {
+            return std::nullopt;
+        }
+
+        if (static_cast<uint64_t>(reader.ReadInt64(ChecksumOffset)) != GetChecksum(data + HeaderSize, size - HeaderSize))
+        {
+            return std::nullopt;
+        }
+
+        // String offsets are checked when strings are read, so only the records need to be checked here.
+        for (uint32_t i = 0; i < entryCount; i++)
+        {
+            auto offset = HeaderSize + i * EntrySize;
+            auto kind = static_cast<WarmStartEntryKind>(reader.ReadUInt32(offset));
+            size_t itemCount = reader.ReadUInt32(offset + 12);
+            size_t itemsOffset = reader.ReadUInt32(offset + 16);
+            if (((kind != WarmStartEntryKind::ComputeSystems) && (kind != WarmStartEntryKind::Repositories)) ||
+                (itemsOffset < entryTableEnd) ||
+                (itemsOffset + itemCount * GetRecordSize(kind) > stringTableOffset))
+            {
+                return std::nullopt;
+            }
+        }
+
+        reader.m_entryCount = entryCount;
+        reader.m_stringTableOffset = stringTableOffset;
+        return reader;
+    }
+
+    size_t WarmStartCacheReader::EntryCount() const
+    {
+        return m_entryCount;
+    }
+
+    WarmStartCacheReader::Entry WarmStartCacheReader::GetEntry(size_t index) const
+    {
+        auto offset = HeaderSize + index * EntrySize;
+        return Entry{
+            static_cast<WarmStartEntryKind>(ReadUInt32(offset)),
+            ReadString(ReadUInt32(offset + 4)),
+            ReadString(ReadUInt32(offset + 8)),
+            ReadUInt32(offset + 12),
+            ReadUInt32(offset + 16),
+        };
+    }
+
+    std::optional<WarmStartCacheReader::Entry> WarmStartCacheReader::Find(WarmStartEntryKind kind, std::u16string_view providerId, std::u16string_view developerId) const
+    {
+        for (size_t i = 0; i < m_entryCount; i++)
+        {
+            auto entry = GetEntry(i);
+            if ((entry.kind == kind) && (entry.providerId == providerId) && (entry.developerId == developerId))
+            {
+                return entry;
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    WarmStartComputeSystem WarmStartCacheReader::GetComputeSystem(Entry const& entry, uint32_t index) const
+    {
+        auto offset = entry.itemsOffset + static_cast<size_t>(index) * ComputeSystemRecordSize;
+        return WarmStartComputeSystem{
+            ReadString(ReadUInt32(offset)),
+            ReadString(ReadUInt32(offset + 4)),
+            ReadString(ReadUInt32(offset + 8)),
+            ReadUInt32(offset + 12),
+            ReadUInt32(offset + 16),
+        };
+    }
+
+    WarmStartRepository WarmStartCacheReader::GetRepository(Entry const& entry, uint32_t index) const
+    {
+        auto offset = entry.itemsOffset + static_cast<size_t>(index) * RepositoryRecordSize;
+        return WarmStartRepository{
+            ReadString(ReadUInt32(offset)),
+            ReadString(ReadUInt32(offset + 4)),
+            ReadString(ReadUInt32(offset + 8)),
+            ReadUInt32(offset + 12) != 0,
+            ReadInt64(offset + 16),
+        };
+    }
+
+    uint32_t WarmStartCacheReader::ReadUInt32(size_t offset) const
+    {
+        uint32_t value;
+        std::memcpy(&value, m_data + offset, sizeof(value));
+        return value;
+    }
+
+    int64_t WarmStartCacheReader::ReadInt64(size_t offset) const
+    {
+        int64_t value;
+        std::memcpy(&value, m_data + offset, sizeof(value));
+        return value;
+    }
+
+    std::u16string_view WarmStartCacheReader::ReadString(size_t offset) const
+    {
+        if ((offset < m_stringTableOffset) || (offset % StringAlignment != 0) || (offset + sizeof(uint32_t) > m_size))
+        {
+            return {};
+        }
+
+        size_t length = ReadUInt32(offset);
+        if (length > (m_size - offset - sizeof(uint32_t)) / sizeof(char16_t))
+        {
+            return {};
+        }
+
+        // The mapped file is page aligned and strings are aligned in the file.
+        return { reinterpret_cast<char16_t const*>(m_data + offset + sizeof(uint32_t)), length };
+    }
+
+    WarmStartMappedFile::~WarmStartMappedFile()
+    {
+        Close();
+    }
+
+    bool WarmStartMappedFile::Open(std::filesystem::path const& path)
+    {
+        Close();
+
+#ifdef _WIN32
+        auto file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER size{};
+        HANDLE mapping = nullptr;
+        if (GetFileSizeEx(file, &size) && (size.QuadPart > 0) && (static_cast<uint64_t>(size.QuadPart) <= SIZE_MAX))
+        {
+            mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        }
+
+        CloseHandle(file);
+        if (mapping == nullptr)
+        {
+            return false;
+        }
+
+        // The view keeps the mapping alive.
+        auto view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+        if (view == nullptr)
+        {
+            return false;
+        }
+
+        auto mappedSize = static_cast<size_t>(size.QuadPart);
+#else
+        auto file = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (file < 0)
+        {
+            return false;
+        }
+
+        struct stat status{};
+        void* view = MAP_FAILED;
+        if ((fstat(file, &status) == 0) && (status.st_size > 0))
+        {
+            view = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+        }
+
+        close(file);
+        if (view == MAP_FAILED)
+        {
+            return false;
+        }
+
+        auto mappedSize = static_cast<size_t>(status.st_size);
+#endif
+
+        m_data = static_cast<uint8_t const*>(view);
+        m_size = mappedSize;
+        return true;
+    }
+
+    void WarmStartMappedFile::Close()
+    {
+        if (m_data != nullptr)
+        {
+#ifdef _WIN32
+            UnmapViewOfFile(m_data);
+#else
+            munmap(const_cast<uint8_t*>(m_data), m_size);
+#endif
+            m_data = nullptr;
+            m_size = 0;
+        }
+    }
+
+    uint8_t const* WarmStartMappedFile::Data() const
+    {
+        return m_data;
+    }
+
+    size_t WarmStartMappedFile::Size() const
+    {
+        return m_size;
+    }
+
+    bool WriteWarmStartCacheFile(std::filesystem::path const& path, std::vector<uint8_t> const& bytes)
+    {
+        auto temporaryPath = path;
+        temporaryPath += ".tmp";
+
+        {
+            std::ofstream stream{ temporaryPath, std::ios::binary | std::ios::trunc };
+            stream.write(reinterpret_cast<char const*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+            stream.close();
+            if (!stream)
+            {
+                std::error_code error;
+                std::filesystem::remove(temporaryPath, error);
+                return false;
+            }
+        }
+
+        std::error_code error;
+        std::filesystem::rename(temporaryPath, path, error);
+        if (error)
+        {
+            std::filesystem::remove(temporaryPath, error);
+            return false;
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,129 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+namespace winrt::Microsoft::Windows::DevHome::SDK::implementation
+{
+    // On-disk format behind WarmStartCache. The file starts with a fixed header, followed by a table of entries
+    // (one per provider ID, developer ID and kind), the fixed size records of every entry, and a table of the
+    // distinct strings used by the records. Records reference strings by their offset in the file, so strings
+    // repeated across entries, like owners and provider IDs, are stored once. All integers are little endian and
+    // strings are UTF-16. The reader works directly on the bytes of a mapped file and only decodes the records
+    // that are requested. This code only depends on the C++ standard library and the platform file mapping
+    // functions, so the format can be tested on any platform.
+    struct WarmStartComputeSystem
+    {
+        std::u16string_view id;
+        std::u16string_view displayName;
+        std::u16string_view supplementalDisplayName;
+        uint32_t state;
+        uint32_t supportedOperations;
+    };
+
+    struct WarmStartRepository
+    {
+        std::u16string_view displayName;
+        std::u16string_view owningAccountName;
+        std::u16string_view repoUri;
+        bool isPrivate;
+        int64_t lastUpdated;
+    };
+
+    enum class WarmStartEntryKind : uint32_t
+    {
+        ComputeSystems = 1,
+        Repositories = 2,
+    };
+
+    // Serializes entries to the current version of the format. The strings are copied when an entry is added.
+    // The class is not thread safe.
+    class WarmStartCacheWriter
+    {
+    public:
+        void AddComputeSystems(std::u16string_view providerId, std::u16string_view developerId, std::vector<WarmStartComputeSystem> const& computeSystems);
+        void AddRepositories(std::u16string_view providerId, std::u16string_view developerId, std::vector<WarmStartRepository> const& repositories);
+
+        std::vector<uint8_t> Serialize() const;
+
+    private:
+        struct Entry
+        {
+            WarmStartEntryKind kind;
+            uint32_t providerId;
+            uint32_t developerId;
+            uint32_t itemCount;
+
+            // The fields of every record, with strings as indexes in m_strings.
+            std::vector<uint32_t> fields;
+            std::vector<int64_t> timestamps;
+        };
+
+        uint32_t Intern(std::u16string_view text);
+
+        std::vector<Entry> m_entries;
+        std::vector<std::u16string> m_strings;
+        std::unordered_map<std::u16string, uint32_t> m_stringLookup;
+    };
+
+    // Reads a serialized cache without copying it. The bytes must stay valid while the reader and the string
+    // views it returns are used. Open validates the header, the checksum and the bounds of the tables, and fails
+    // for files written by another version of the format. The class is not thread safe.
+    class WarmStartCacheReader
+    {
+    public:
+        struct Entry
+        {
+            WarmStartEntryKind kind;
+            std::u16string_view providerId;
+            std::u16string_view developerId;
+            uint32_t itemCount;
+            uint32_t itemsOffset;
+        };
+
+        static std::optional<WarmStartCacheReader> Open(uint8_t const* data, size_t size);
+
+        size_t EntryCount() const;
+        Entry GetEntry(size_t index) const;
+        std::optional<Entry> Find(WarmStartEntryKind kind, std::u16string_view providerId, std::u16string_view developerId) const;
+
+        WarmStartComputeSystem GetComputeSystem(Entry const& entry, uint32_t index) const;
+        WarmStartRepository GetRepository(Entry const& entry, uint32_t index) const;
+
+    private:
+        WarmStartCacheReader(uint8_t const* data, size_t size);
+
+        uint32_t ReadUInt32(size_t offset) const;
+        int64_t ReadInt64(size_t offset) const;
+        std::u16string_view ReadString(size_t offset) const;
+
+        uint8_t const* m_data;
+        size_t m_size;
+        uint32_t m_entryCount{ 0 };
+        size_t m_stringTableOffset{ 0 };
+    };
+
+    // A read only view of a whole file. Open returns false if the file is missing, empty or can't be mapped.
+    class WarmStartMappedFile
+    {
+    public:
+        WarmStartMappedFile() = default;
+        WarmStartMappedFile(WarmStartMappedFile const&) = delete;
+        WarmStartMappedFile& operator=(WarmStartMappedFile const&) = delete;
+        ~WarmStartMappedFile();
+
+        bool Open(std::filesystem::path const& path);
+        void Close();
+
+        uint8_t const* Data() const;
+        size_t Size() const;
+
+    private:
+        uint8_t const* m_data{ nullptr };
+        size_t m_size{ 0 };
+    };
+
+    // Writes the bytes to a temporary file next to path and moves it over path, so that readers never see a
+    // partially written file. Returns false if the file couldn't be written.
+    bool WriteWarmStartCacheFile(std::filesystem::path const& path, std::vector<uint8_t> const& bytes);
+}